@@ -0,0 +1,23 @@
+// Food glow quads (Render::Batch::FoodBatch), additive.
+// texture: the atlas glow cell, falloff in alpha
+// gl_Color.rgb = food color, gl_Color.a = pulse offset as a fraction of phaseSpan
+uniform sampler2D texture;
+uniform float time;
+uniform float phaseSpan;
+
+void main()
+{
+    float intensity = texture2D(texture, gl_TexCoord[0].xy).a;
+
+    float t = time + gl_Color.a * phaseSpan;
+    float pulseSpeed = 0.9 + 0.35 * sin(t * 0.8);
+
+    float minIntensity = 0.7;
+    float pulse = minIntensity + (1.0 - minIntensity) * (0.5 + 0.5 * sin(t * pulseSpeed));
+    intensity *= pulse;
+
+    float alpha = 0.5 + 0.5 * sin(t * (pulseSpeed / 2.0));
+    alpha = clamp(alpha, 0.5, 1.0);
+
+    gl_FragColor = vec4(gl_Color.rgb * intensity, alpha * intensity);
+}
@@ -0,0 +1,48 @@
+// Snake circles drawn as quads (Render::Batch::SnakeBatch).
+// gl_TexCoord[0] = 2 * (kind, phase) + 0.25 + 0.5 * corner, see snake_batch.hpp
+//   kind 0:      plain disc in gl_Color (soft pass, shadow, highlight, eyes)
+//   kind 1 + q:  body: gl_Color fill, dark outline ring of q / 128 of the radius,
+//                shimmer over the fill; phase = segment index
+uniform float time;
+
+void main()
+{
+    vec2 tc = gl_TexCoord[0].xy;
+    vec2 cell = floor(tc * 0.5);
+    vec2 uv = (tc - cell * 2.0 - 0.25) * 2.0 - 1.0;
+
+    float d = length(uv); // 0 center, 1 edge of the quad's circle
+    float aa = max(fwidth(d), 0.0001);
+    float coverage = 1.0 - smoothstep(1.0 - aa, 1.0, d);
+
+    vec4 fill = gl_Color;
+
+    if (cell.x < 0.5)
+    {
+        gl_FragColor = vec4(fill.rgb, fill.a * coverage);
+        return;
+    }
+
+    float inner = 1.0 - (cell.x - 1.0) / 128.0;
+    float ring = smoothstep(inner - aa, inner, d);
+
+    // fill + outline (the fill alpha is the spawn / kill factor)
+    float outlineAlpha = min(110.0, 60.0 + 50.0 * fill.a) / 255.0;
+    vec4 body = mix(fill, vec4(0.0, 0.0, 0.0, outlineAlpha), ring);
+    body.a *= coverage;
+
+    // shimmer over the fill only
+    float t = time + cell.y * 0.045;
+    float pulse = 0.9 + 0.1 * sin(t * 2.0);
+    float intensity = smoothstep(0.5, 0.0, 0.5 * d / inner) * pulse;
+
+    vec4 base = vec4(fill.rgb * 0.85, fill.a * 0.65);
+    vec4 shimmer = base + vec4(base.rgb * intensity, base.a * intensity * 0.5);
+    shimmer.a = clamp(shimmer.a, 0.0, 1.0) * (1.0 - ring) * coverage;
+
+    // shimmer over body, as two alpha-blended draws would give
+    float a = shimmer.a + body.a * (1.0 - shimmer.a);
+    vec3 rgb = (shimmer.rgb * shimmer.a + body.rgb * body.a * (1.0 - shimmer.a)) / max(a, 0.0001);
+
+    gl_FragColor = vec4(rgb, a);
+}
@@ -0,0 +1,128 @@
+#include "services/game/drift_validation.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace Core::App::Game;
+
+namespace
+{
+    constexpr float BodyRadius = 24.f;
+    constexpr float SegmentStep = 6.f;
+
+    // wavy body, head first; built with PushFront like a moving snake so the ring wraps
+    SegmentRing MakeBody(const std::size_t count)
+    {
+        SegmentRing ring;
+        ring.Reserve(count);
+
+        for (std::size_t i = count; i-- > 0; )
+        {
+            const float t = static_cast<float>(i);
+            ring.PushFront({ t * SegmentStep, 80.f * std::sin(t * 0.05f) });
+        }
+
+        // rotate a quarter so both contiguous runs are used
+        for (std::size_t i = 0; i < count / 4; ++i)
+        {
+            const auto tail = ring.back();
+            ring.PopBack();
+            ring.PushFront(tail);
+        }
+
+        return ring;
+    }
+
+    // what the server would send: the same resample with a little jitter
+    std::vector<sf::Vector2f> MakeServerSamples(const SegmentRing& body)
+    {
+        std::vector<sf::Vector2f> samples;
+        BuildExpectedSamplesByRadius(body, BodyRadius, samples);
+
+        for (std::size_t i = 0; i < samples.size(); ++i)
+        {
+            samples[i].x += (i % 3 == 0) ? 1.5f : -0.5f;
+        }
+
+        return samples;
+    }
+
+    void BM_DriftTwoPass(benchmark::State& state)
+    {
+        const auto body = MakeBody(static_cast<std::size_t>(state.range(0)));
+        const auto samples = MakeServerSamples(body);
+        std::vector<sf::Vector2f> scratch;
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ValidateSamplesByRadiusTwoPass(body, samples, BodyRadius, 120.f, scratch));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_DriftFused(benchmark::State& state)
+    {
+        const auto body = MakeBody(static_cast<std::size_t>(state.range(0)));
+        const auto samples = MakeServerSamples(body);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ValidateSamplesByRadius(body, samples, BodyRadius, 120.f));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // straight line, one contiguous run; the limit is never reached so the whole run is scanned
+    struct Line
+    {
+        std::vector<float> xs;
+        std::vector<float> ys;
+    };
+
+    Line MakeLine(const std::size_t count)
+    {
+        Line line;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            line.xs.push_back(static_cast<float>(i) * SegmentStep);
+            line.ys.push_back(0.f);
+        }
+
+        return line;
+    }
+
+    void BM_FindBeyondScalar(benchmark::State& state)
+    {
+        const auto line = MakeLine(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Detail::FindBeyondScalar(line.xs.data(), line.ys.data(), 0, line.xs.size(), 0.f, 0.f, 1e30f));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_FindBeyond(benchmark::State& state)
+    {
+        const auto line = MakeLine(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Detail::FindBeyond(line.xs.data(), line.ys.data(), 0, line.xs.size(), 0.f, 0.f, 1e30f));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_DriftTwoPass)->Arg(100)->Arg(1'000)->Arg(10'000)->Arg(60'000);
+BENCHMARK(BM_DriftFused)->Arg(100)->Arg(1'000)->Arg(10'000)->Arg(60'000);
+
+// raw scan throughput (no hit): dispatched SIMD vs scalar
+BENCHMARK(BM_FindBeyondScalar)->Arg(100)->Arg(1'000)->Arg(10'000)->Arg(60'000);
+BENCHMARK(BM_FindBeyond)->Arg(100)->Arg(1'000)->Arg(10'000)->Arg(60'000);
@@ -0,0 +1,385 @@
+#include "services/game/game_client.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // private decode steps, see the friend declaration in GameClient
+    class GameClientBench
+    {
+    public:
+        static void ApplyFullUpdate(GameClient& client, const std::vector<std::uint8_t>& payload)
+        {
+            Utils::Legacy::Game::Net::ByteReader reader(payload);
+            client.ApplyFullUpdate(reader);
+        }
+
+        static void ApplyPartialUpdate(GameClient& client, const std::vector<std::uint8_t>& payload)
+        {
+            Utils::Legacy::Game::Net::ByteReader reader(payload);
+            client.ApplyPartialUpdate(reader);
+        }
+
+        static void ApplySnakeSnapshot(GameClient& client, const std::vector<std::uint8_t>& payload)
+        {
+            Utils::Legacy::Game::Net::ByteReader reader(payload);
+            client.ApplySnakeSnapshot(reader);
+        }
+
+        static void SweepStaleEntities(GameClient& client)
+        {
+            client.SweepStaleEntities();
+        }
+
+        static void SetServerSeq(GameClient& client, const std::uint32_t seq)
+        {
+            client.net_.hasSeq = true;
+            client.net_.lastServerSeq = seq;
+        }
+    };
+}
+
+using namespace Core::App::Game;
+using namespace Utils::Legacy::Game::Net;
+
+namespace
+{
+    constexpr std::uint32_t PlayerID = 1;
+    constexpr std::uint32_t FoodIDBase = 1'000'000;
+
+    constexpr float SegmentStep = 6.f;
+    constexpr float SampleStep = 24.f;   // ~ snake radius, what the server resamples by
+    constexpr float SnakeSpread = 1500.f;
+    constexpr float FoodSpread = 3000.f;
+
+    // snakes scattered around the player (entity 1, at the center), wavy bodies trailing
+    // away from it; food scattered over a disc. Seeded, every run gets the same world
+    struct World
+    {
+        struct SnakeData
+        {
+            std::uint32_t entityID;
+            std::vector<sf::Vector2f> body; // head first
+        };
+
+        std::vector<SnakeData> snakes;
+        std::vector<std::pair<std::uint32_t, sf::Vector2f>> foods;
+    };
+
+    World MakeWorld(const std::size_t snakeCount, const std::size_t segments, const std::size_t foodCount)
+    {
+        World world;
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+        const sf::Vector2f center = Utils::Legacy::Game::AreaCenter;
+
+        for (std::size_t s = 0; s < snakeCount; ++s)
+        {
+            const float angle = 6.2831853f * unit(rng);
+            const float distance = (s == 0) ? 0.f : SnakeSpread * std::sqrt(unit(rng));
+            const sf::Vector2f head = center + sf::Vector2f(std::cos(angle), std::sin(angle)) * distance;
+            const sf::Vector2f back(std::cos(angle + 2.f), std::sin(angle + 2.f));
+            const sf::Vector2f side(-back.y, back.x);
+
+            auto& snake = world.snakes.emplace_back();
+            snake.entityID = PlayerID + static_cast<std::uint32_t>(s);
+            snake.body.reserve(segments);
+
+            for (std::size_t i = 0; i < segments; ++i)
+            {
+                const float t = static_cast<float>(i);
+                snake.body.push_back(head + back * (t * SegmentStep) + side * (40.f * std::sin(t * 0.05f)));
+            }
+        }
+
+        for (std::size_t f = 0; f < foodCount; ++f)
+        {
+            const float angle = 6.2831853f * unit(rng);
+            const float distance = FoodSpread * std::sqrt(unit(rng));
+            world.foods.emplace_back(FoodIDBase + static_cast<std::uint32_t>(f),
+                                     center + sf::Vector2f(std::cos(angle), std::sin(angle)) * distance);
+        }
+
+        return world;
+    }
+
+    // server side of Net::ReadDeltaPoints (the client never encodes points): DeltaPointsHeader,
+    // then each quantised step from the previous point as two zigzag varints. The bench
+    // bodies step a few units, nothing overflows int16
+    void WriteDeltaPoints(ByteWriter& w, const sf::Vector2f& head, const std::vector<sf::Vector2f>& points)
+    {
+        const Net::DeltaPointsHeader dh{};
+        w.WritePod(dh);
+
+        const float scale = static_cast<float>(1u << dh.quantShift);
+        const auto quantize = [&](const float v) { return static_cast<std::int32_t>(std::lround(v * scale)); };
+
+        const auto writeVarint = [&](const std::int32_t v)
+        {
+            auto z = (static_cast<std::uint32_t>(v) << 1) ^ static_cast<std::uint32_t>(v >> 31);
+            while (z >= 0x80)
+            {
+                w.WritePod(static_cast<std::uint8_t>(z | 0x80));
+                z >>= 7;
+            }
+            w.WritePod(static_cast<std::uint8_t>(z));
+        };
+
+        std::int32_t px = quantize(head.x);
+        std::int32_t py = quantize(head.y);
+
+        for (const auto& p : points)
+        {
+            const std::int32_t qx = quantize(p.x);
+            const std::int32_t qy = quantize(p.y);
+
+            writeVarint(qx - px);
+            writeVarint(qy - py);
+
+            px = qx;
+            py = qy;
+        }
+    }
+
+    void WriteSnake(ByteWriter& w, const std::uint32_t entityID, const EntityFlags flags,
+                    const std::vector<sf::Vector2f>& body, const std::vector<sf::Vector2f>& points,
+                    const SnakePointsKind kind)
+    {
+        w.WritePod(EntityEntryHeader{ EntityType::Snake, flags, entityID });
+
+        SnakeState ss{};
+        ss.headX = body.front().x;
+        ss.headY = body.front().y;
+        ss.experience = static_cast<std::uint32_t>(body.size()) * 10;
+        ss.totalSegments = static_cast<std::uint16_t>(body.size());
+        ss.pointsKind = kind;
+        ss.pointsCount = static_cast<std::uint16_t>(points.size());
+        w.WritePod(ss);
+
+        for (const auto& p : points)
+        {
+            w.WritePod(p.x);
+            w.WritePod(p.y);
+        }
+    }
+
+    void WriteFoods(ByteWriter& w, const World& world)
+    {
+        for (const auto& [id, position] : world.foods)
+        {
+            w.WritePod(EntityEntryHeader{ EntityType::Food, EntityFlags::None, id });
+            w.WritePod(FoodState{ position.x, position.y });
+        }
+    }
+
+    std::vector<std::uint8_t> MakeFullUpdate(const World& world)
+    {
+        ByteWriter w(1024);
+        w.WritePod(FullUpdateHeader{ PlayerID });
+
+        for (const auto& snake : world.snakes)
+            WriteSnake(w, snake.entityID, EntityFlags::None, snake.body, snake.body, SnakePointsKind::FullSegments);
+
+        WriteFoods(w, world);
+        return w.Data();
+    }
+
+    // drift validation samples for every snake, plus every food
+    std::vector<std::uint8_t> MakePartialUpdate(const World& world)
+    {
+        ByteWriter w(1024);
+        SegmentRing ring;
+        std::vector<sf::Vector2f> samples;
+
+        for (const auto& snake : world.snakes)
+        {
+            ring.Clear();
+            for (auto it = snake.body.rbegin(); it != snake.body.rend(); ++it)
+                ring.PushFront(*it);
+
+            BuildExpectedSamplesByRadius(ring, SampleStep, samples);
+            WriteSnake(w, snake.entityID, EntityFlags::None, snake.body, samples, SnakePointsKind::Samples);
+        }
+
+        WriteFoods(w, world);
+        return w.Data();
+    }
+
+    std::vector<std::uint8_t> MakeSnapshot(const World::SnakeData& snake)
+    {
+        ByteWriter w(1024);
+        WriteSnake(w, snake.entityID, EntityFlags::None, snake.body, snake.body, SnakePointsKind::FullSegments);
+        return w.Data();
+    }
+
+    const Core::BaseServiceContainer& BenchContainer()
+    {
+        static const Core::BaseServiceContainer container{ Utils::Logging::Logger::Create("BENCH") };
+        return container;
+    }
+
+    GameClient::Shared MakeClient(const World& world)
+    {
+        auto client = GameClient::CreateOffline(&BenchContainer());
+        GameClientBench::ApplyFullUpdate(*client, MakeFullUpdate(world));
+        return client;
+    }
+
+    void SetWorldCounters(benchmark::State& state)
+    {
+        state.counters["snakes"] = static_cast<double>(state.range(0));
+        state.counters["segments"] = static_cast<double>(state.range(1));
+        state.counters["foods"] = static_cast<double>(state.range(2));
+    }
+
+    // steady state: the world is already known, the update reconciles it in place
+    void BM_ApplyFullUpdate(benchmark::State& state)
+    {
+        const auto world = MakeWorld(state.range(0), state.range(1), state.range(2));
+        const auto payload = MakeFullUpdate(world);
+        const auto client = MakeClient(world);
+
+        for (auto _ : state)
+        {
+            GameClientBench::ApplyFullUpdate(*client, payload);
+        }
+
+        SetWorldCounters(state);
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(payload.size()));
+    }
+
+    // every snake validated against its samples; bodies step on each apply, so the world
+    // is reset (untimed) before every iteration to keep validation passing
+    void BM_ApplyPartialUpdate(benchmark::State& state)
+    {
+        const auto world = MakeWorld(state.range(0), state.range(1), state.range(2));
+        const auto full = MakeFullUpdate(world);
+        const auto payload = MakePartialUpdate(world);
+        const auto client = MakeClient(world);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            GameClientBench::ApplyFullUpdate(*client, full);
+            state.ResumeTiming();
+
+            GameClientBench::ApplyPartialUpdate(*client, payload);
+        }
+
+        SetWorldCounters(state);
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(payload.size()));
+    }
+
+    void BM_ApplySnakeSnapshot(benchmark::State& state)
+    {
+        const auto world = MakeWorld(2, state.range(0), 0);
+        const auto payload = MakeSnapshot(world.snakes.back());
+        const auto client = MakeClient(world);
+
+        for (auto _ : state)
+        {
+            GameClientBench::ApplySnakeSnapshot(*client, payload);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // range(1): 0 raw floats, 1 delta coded
+    void BM_ReadSnakePoints(benchmark::State& state)
+    {
+        const auto world = MakeWorld(1, state.range(0), 0);
+        const auto& body = world.snakes.front().body;
+        const bool delta = state.range(1) != 0;
+
+        SnakeState ss{};
+        ss.headX = body.front().x;
+        ss.headY = body.front().y;
+        ss.totalSegments = static_cast<std::uint16_t>(body.size());
+        ss.pointsCount = ss.totalSegments;
+        ss.pointsKind = delta ? Net::PointsKind_FullSegmentsDelta : SnakePointsKind::FullSegments;
+
+        ByteWriter w(1024);
+        if (delta)
+        {
+            WriteDeltaPoints(w, body.front(), body);
+        }
+        else
+        {
+            for (const auto& p : body)
+            {
+                w.WritePod(p.x);
+                w.WritePod(p.y);
+            }
+        }
+
+        const auto payload = w.Data();
+        std::vector<sf::Vector2f> points;
+
+        for (auto _ : state)
+        {
+            ByteReader reader(payload);
+            benchmark::DoNotOptimize(ReadSnakePoints(reader, ss, points));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(payload.size()));
+    }
+
+    // everything is stale: the sweep drops what is out of view and keeps the rest, so the
+    // world is reset (untimed) before every iteration, seen at seq 0 and swept at seq 1000
+    void BM_SweepStaleEntities(benchmark::State& state)
+    {
+        const auto world = MakeWorld(state.range(0), state.range(1), state.range(2));
+        const auto full = MakeFullUpdate(world);
+        const auto client = MakeClient(world);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            GameClientBench::SetServerSeq(*client, 0);
+            GameClientBench::ApplyFullUpdate(*client, full);
+            GameClientBench::SetServerSeq(*client, 1'000);
+            state.ResumeTiming();
+
+            GameClientBench::SweepStaleEntities(*client);
+        }
+
+        SetWorldCounters(state);
+        state.SetItemsProcessed(state.iterations() * (state.range(0) + state.range(2)));
+    }
+
+    void BM_GetNearestFoods(benchmark::State& state)
+    {
+        const auto world = MakeWorld(1, 100, state.range(0));
+        const auto client = MakeClient(world);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(client->GetNearestFoods());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // {snakes, segments per snake, foods}
+    void WorldArgs(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({ "snakes", "segments", "foods" });
+        b->Args({ 10, 100, 500 });
+        b->Args({ 50, 300, 2'000 });
+        b->Args({ 200, 300, 5'000 });
+        b->Args({ 50, 2'000, 2'000 });
+    }
+}
+
+BENCHMARK(BM_ApplyFullUpdate)->Apply(WorldArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApplyPartialUpdate)->Apply(WorldArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApplySnakeSnapshot)->Arg(100)->Arg(1'000)->Arg(10'000);
+BENCHMARK(BM_ReadSnakePoints)->ArgNames({ "segments", "delta" })->ArgsProduct({ { 100, 1'000, 10'000 }, { 0, 1 } });
+BENCHMARK(BM_SweepStaleEntities)->Apply(WorldArgs);
+BENCHMARK(BM_GetNearestFoods)->Arg(500)->Arg(2'000)->Arg(10'000);
@@ -0,0 +1,248 @@
+// Headless load generator: N GameClient instances against one server, each driven by a bot
+// that only sets destinations. No window, no render services, no websocket login: the
+// clients open plain UDP sessions (the server has to accept sessions that are not bound
+// to an account, as it does for local testing).
+//
+//   snake-app-bot [clients=100] [serverID=0] [walk|circle] [seconds=0 (run forever)] [reportSeconds=5]
+//
+// Host comes from WS_HOST like in the app. Every report prints one line per client plus
+// a total; rates are over the report window, counters are deltas over it.
+
+#include "[core_loader].hpp"
+#include "logging.hpp"
+
+#include "services/game/game_client.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace Core::App::Game;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    enum class Behaviour
+    {
+        Walk,   // random waypoints around the head
+        Circle, // orbit around the spawn point
+    };
+
+    constexpr float WalkStepMin = 300.f;
+    constexpr float WalkStepMax = 900.f;
+    constexpr float WalkReached = 50.f;
+    constexpr auto WalkRetarget = std::chrono::seconds(3);
+
+    constexpr float CircleRadius = 400.f;
+    constexpr float CircleSpeed = 1.5f; // rad/s
+
+    // hundreds of clients in one process: one UDP io thread each, the shared NetLoop does the rest
+    constexpr std::uint32_t IoThreads = 1;
+
+    struct Bot
+    {
+        GameClient::Shared client;
+        std::uint32_t reconnects { 0 };
+
+        std::mt19937 rng;
+
+        sf::Vector2f target;
+        Clock::time_point retargetAt;
+
+        bool hasOrbit { false };
+        sf::Vector2f orbitCenter;
+        float orbitAngle { 0.f };
+
+        // report window
+        DebugInfo last {};
+        float lateMaxMs { 0.f };
+    };
+
+    template <class T>
+    T ArgOr(const int argc, char ** argv, const int index, const T fallback)
+    {
+        if (index >= argc)
+            return fallback;
+
+        const std::string_view arg = argv[index];
+
+        T value {};
+        if (std::from_chars(arg.data(), arg.data() + arg.size(), value).ec != std::errc{})
+            return fallback;
+
+        return value;
+    }
+
+    float Length(const sf::Vector2f v)
+    {
+        return std::sqrt(v.x * v.x + v.y * v.y);
+    }
+
+    // keeps waypoints inside the arena
+    sf::Vector2f ClampToArea(const sf::Vector2f p)
+    {
+        const sf::Vector2f center = Utils::Legacy::Game::AreaCenter;
+        const float radius = Utils::Legacy::Game::AreaRadius * 0.9f;
+
+        const auto offset = p - center;
+        const float distance = Length(offset);
+        if (distance <= radius)
+            return p;
+
+        return center + offset * (radius / distance);
+    }
+
+    void Drive(Bot & bot, const Behaviour behaviour, const Clock::time_point now, const float dt)
+    {
+        const auto snake = bot.client->GetPlayerSnake();
+        if (!snake)
+        {
+            bot.hasOrbit = false;
+            return;
+        }
+
+        const auto head = snake->GetPosition();
+
+        if (behaviour == Behaviour::Circle)
+        {
+            if (!bot.hasOrbit)
+            {
+                bot.hasOrbit = true;
+                bot.orbitCenter = head;
+                bot.orbitAngle = std::uniform_real_distribution<float>(0.f, 6.2831853f)(bot.rng);
+            }
+
+            bot.orbitAngle += CircleSpeed * dt;
+            snake->SetDestination(ClampToArea(bot.orbitCenter + sf::Vector2f(std::cos(bot.orbitAngle), std::sin(bot.orbitAngle)) * CircleRadius));
+            return;
+        }
+
+        if (now >= bot.retargetAt || Length(bot.target - head) < WalkReached)
+        {
+            const float angle = std::uniform_real_distribution<float>(0.f, 6.2831853f)(bot.rng);
+            const float step = std::uniform_real_distribution<float>(WalkStepMin, WalkStepMax)(bot.rng);
+
+            bot.target = ClampToArea(head + sf::Vector2f(std::cos(angle), std::sin(angle)) * step);
+            bot.retargetAt = now + WalkRetarget;
+        }
+
+        snake->SetDestination(bot.target);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    const auto log = Utils::Logging::Logger::Create("BOT");
+    Utils::SetDefaultLogger(log);
+
+    const auto clients = std::max(ArgOr<std::uint32_t>(argc, argv, 1, 100), 1u);
+    const auto serverID = static_cast<std::uint8_t>(ArgOr<std::uint32_t>(argc, argv, 2, 0));
+    const auto behaviour = (argc > 3 && std::string_view(argv[3]) == "circle") ? Behaviour::Circle : Behaviour::Walk;
+    const auto seconds = ArgOr<std::uint32_t>(argc, argv, 4, 0);
+    const auto reportEvery = std::chrono::seconds(std::max(ArgOr<std::uint32_t>(argc, argv, 5, 5), 1u));
+
+    Core::BaseServiceContainer baseContainer{ log };
+
+    std::vector<Bot> bots(clients);
+    for (std::uint32_t i = 0; i < clients; ++i)
+    {
+        bots[i].client = GameClient::Create(&baseContainer, serverID, IoThreads);
+        bots[i].rng.seed(i + 1);
+    }
+
+    log->Msg("{} bots ({}) on server {}", clients, behaviour == Behaviour::Circle ? "circle" : "walk", serverID);
+
+    const auto started = Clock::now();
+    auto lastPass = started;
+    auto reportAt = started + reportEvery;
+    auto windowStart = started;
+
+    for (;;)
+    {
+        const auto now = Clock::now();
+        const float dt = std::chrono::duration<float>(now - lastPass).count();
+        lastPass = now;
+
+        for (auto & bot : bots)
+        {
+            if (bot.client->IsTimeout())
+            {
+                bot.client = GameClient::Create(&baseContainer, serverID, IoThreads);
+                bot.last = {};
+                bot.hasOrbit = false;
+                bot.reconnects++;
+            }
+
+            bot.client->ProcessTick();
+            Drive(bot, behaviour, now, dt);
+
+            bot.lateMaxMs = std::max(bot.lateMaxMs, bot.client->GetDebugInfo().tickLateMs);
+        }
+
+        if (now >= reportAt)
+        {
+            const float window = std::chrono::duration<float>(now - windowStart).count();
+
+            std::uint32_t connected = 0;
+            std::uint64_t totalBytes = 0;
+            std::uint64_t totalDatagrams = 0;
+            std::uint64_t totalDecodeMicros = 0;
+            std::uint64_t totalBad = 0;
+            std::uint64_t totalResyncs = 0;
+            float worstLateMs = 0.f;
+
+            for (std::uint32_t i = 0; i < clients; ++i)
+            {
+                auto & bot = bots[i];
+                const auto info = bot.client->GetDebugInfo();
+
+                const auto bytes = info.bytesReceived - bot.last.bytesReceived;
+                const auto datagrams = info.datagramsReceived - bot.last.datagramsReceived;
+                const auto decodeMicros = info.decodeMicros - bot.last.decodeMicros;
+                const auto bad = info.badPacketsDropped - bot.last.badPacketsDropped;
+                const auto resyncs = info.fullRequestsSent - bot.last.fullRequestsSent;
+                const auto lost = info.updatesLost - bot.last.updatesLost;
+                const auto dropped = info.droppedTicks - bot.last.droppedTicks;
+
+                log->Msg("bot {:4} {} in={:.1f}KB/s dgram={}/s decode={:.1f}us/dgram bad={} resync={} lost={} lateMax={:.2f}ms droppedTicks={} reconnects={}",
+                         i, bot.client->IsLoaded() ? "up  " : "down",
+                         bytes / 1024.f / window, static_cast<std::uint64_t>(datagrams / window),
+                         datagrams ? static_cast<float>(decodeMicros) / datagrams : 0.f,
+                         bad, resyncs, lost, bot.lateMaxMs, dropped, bot.reconnects);
+
+                connected += bot.client->IsLoaded() ? 1 : 0;
+                totalBytes += bytes;
+                totalDatagrams += datagrams;
+                totalDecodeMicros += decodeMicros;
+                totalBad += bad;
+                totalResyncs += resyncs;
+                worstLateMs = std::max(worstLateMs, bot.lateMaxMs);
+
+                bot.last = info;
+                bot.lateMaxMs = 0.f;
+            }
+
+            log->Msg("total {}/{} up in={:.1f}KB/s decode={:.1f}us/dgram ({:.1f}% of one core) bad={} resync={} lateMax={:.2f}ms",
+                     connected, clients, totalBytes / 1024.f / window,
+                     totalDatagrams ? static_cast<float>(totalDecodeMicros) / totalDatagrams : 0.f,
+                     totalDecodeMicros / 1e4f / window, totalBad, totalResyncs, worstLateMs);
+
+            windowStart = now;
+            reportAt = now + reportEvery;
+        }
+
+        if (seconds > 0 && now - started >= std::chrono::seconds(seconds))
+            break;
+
+        // the clients keep their own 64 Hz accumulators, this only bounds the spin
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+// Feeds a datagram capture (SNAKE_CAPTURE=<file> on the app) back into an offline GameClient.
+//
+//   snake-app-replay <capture> [max|realtime] [passes=1]
+//
+// The client runs on the recorded clock, not the wall clock: every record first advances
+// the client to its timestamp, inbound datagrams are then applied and outbound ClientInput
+// destinations are given to the player snake. So a replay ends in the same state at any
+// speed, and `max` doubles as a decode throughput benchmark over real traffic.
+
+#include "[core_loader].hpp"
+#include "logging.hpp"
+
+#include "services/game/game_client.hpp"
+#include "services/game/capture_file.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+using namespace Core::App::Game;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    struct PassStats
+    {
+        std::uint64_t inbound { 0 };
+        std::uint64_t outbound { 0 };
+        std::uint64_t inboundBytes { 0 };
+        std::uint64_t inputs { 0 };
+    };
+
+    void ApplyInput(GameClient & client, const Utils::Legacy::Game::Net::ClientInputPayload & input)
+    {
+        if (const auto snake = client.GetPlayerSnake())
+        {
+            snake->SetDestination({ input.destinationX, input.destinationY });
+        }
+    }
+
+    // ClientInput messages in an outbound datagram, bundled or not; returns how many
+    std::uint32_t ReplayInputs(GameClient & client, const std::span<const std::uint8_t> datagram)
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        const auto check = CheckDatagram(datagram);
+        if (!check.Ok())
+            return 0;
+
+        const auto payload = datagram.subspan(sizeof(MessageHeader), check.header.payloadBytes);
+
+        ClientInputPayload input {};
+
+        if (static_cast<MessageType>(check.header.type) == MessageType::ClientInput)
+        {
+            if (payload.size() < sizeof(input))
+                return 0;
+
+            std::memcpy(&input, payload.data(), sizeof(input));
+            ApplyInput(client, input);
+            return 1;
+        }
+
+        if (!Net::IsExt(check.header.type, Net::ExtMessageType::Bundle))
+            return 0;
+
+        std::uint32_t count = 0;
+        std::size_t offset = 0;
+
+        while (offset + sizeof(Net::BundleEntryHeader) <= payload.size())
+        {
+            Net::BundleEntryHeader entry {};
+            std::memcpy(&entry, payload.data() + offset, sizeof(entry));
+            offset += sizeof(entry);
+
+            if (offset + entry.bytes > payload.size())
+                break;
+
+            if (static_cast<MessageType>(entry.type) == MessageType::ClientInput && entry.bytes >= sizeof(input))
+            {
+                std::memcpy(&input, payload.data() + offset, sizeof(input));
+                ApplyInput(client, input);
+                count++;
+            }
+
+            offset += entry.bytes;
+        }
+
+        return count;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    const auto log = Utils::Logging::Logger::Create("REPLAY");
+    Utils::SetDefaultLogger(log);
+
+    if (argc < 2)
+    {
+        log->Error("usage: snake-app-replay <capture> [max|realtime] [passes=1]");
+        return 1;
+    }
+
+    CaptureReader reader;
+    if (!reader.Open(argv[1]))
+    {
+        log->Error("'{}' is not a readable capture", argv[1]);
+        return 1;
+    }
+
+    const bool realtime = argc > 2 && std::string_view(argv[2]) == "realtime";
+
+    std::uint32_t passes = 1;
+    if (argc > 3)
+    {
+        const std::string_view arg = argv[3];
+        std::from_chars(arg.data(), arg.data() + arg.size(), passes);
+    }
+
+    Core::BaseServiceContainer baseContainer{ log };
+
+    for (std::uint32_t pass = 0; pass < std::max(passes, 1u); ++pass)
+    {
+        reader.Rewind();
+
+        const auto client = GameClient::CreateOffline(&baseContainer);
+
+        // any fixed origin works, only differences between record times matter
+        const Clock::time_point origin = Clock::time_point{} + std::chrono::hours(1);
+
+        PassStats stats;
+        CaptureReader::Record record;
+
+        const auto wallStart = Clock::now();
+
+        while (reader.Next(record))
+        {
+            if (realtime)
+            {
+                std::this_thread::sleep_until(wallStart + record.time);
+            }
+
+            const auto time = origin + record.time;
+            client->AdvanceTo(time);
+
+            if (record.direction == CaptureDirection::Inbound)
+            {
+                client->HandleDatagram(record.datagram, time);
+
+                stats.inbound++;
+                stats.inboundBytes += record.datagram.size();
+            }
+            else
+            {
+                stats.inputs += ReplayInputs(*client, record.datagram);
+                stats.outbound++;
+            }
+        }
+
+        const float wallSeconds = std::chrono::duration<float>(Clock::now() - wallStart).count();
+        const auto info = client->GetDebugInfo();
+
+        log->Msg("pass {}: in={} ({:.1f} KB) out={} inputs={} wall={:.3f}s -> {:.0f} dgram/s {:.1f} MB/s decode={:.2f}us/dgram",
+                 pass, stats.inbound, stats.inboundBytes / 1024.f, stats.outbound, stats.inputs, wallSeconds,
+                 wallSeconds > 0.f ? stats.inbound / wallSeconds : 0.f,
+                 wallSeconds > 0.f ? stats.inboundBytes / 1048576.f / wallSeconds : 0.f,
+                 info.datagramsReceived ? static_cast<float>(info.decodeMicros) / info.datagramsReceived : 0.f);
+
+        log->Msg("pass {}: bad={} resync={} lost={} reordered={} late={}",
+                 pass, info.badPacketsDropped, info.fullRequestsSent, info.updatesLost, info.updatesReordered, info.updatesLate);
+
+        // what two replays of the same capture must agree on
+        const auto player = client->GetPlayerSnake();
+        log->Msg("pass {}: frame={} snakes={} foods={} player={} head=({:.3f}, {:.3f})",
+                 pass, client->GetServerFrame(), info.snakesCount, info.foodsCount, info.playerEntityID,
+                 player ? player->GetPosition().x : 0.f, player ? player->GetPosition().y : 0.f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Core::Components::Profiler {
+
+    namespace
+    {
+        constexpr std::array<const char *, PhaseCount> PhaseNames = {
+            "Frame",
+            "NetDrain",
+            "Decode",
+            "Predict",
+            "StaleSweep",
+            "Grid",
+            "Food",
+            "Snakes",
+            "Blur",
+            "UI",
+        };
+
+        float Ms(const FrameProfiler::Clock::duration d)
+        {
+            return std::chrono::duration<float, std::milli>(d).count();
+        }
+    }
+
+    const char * PhaseName(const Phase phase)
+    {
+        return PhaseNames[static_cast<std::size_t>(phase)];
+    }
+
+    void FrameProfiler::Add(const Phase phase, const Clock::time_point start, const Clock::time_point end)
+    {
+        const auto index = static_cast<std::size_t>(phase);
+
+        frame_[index] += end - start;
+        ran_[index] = true;
+
+        if (tracing_ && trace_.size() < MaxTraceEvents)
+        {
+            trace_.push_back({ phase, start, end - start });
+        }
+    }
+
+    void FrameProfiler::EndFrame()
+    {
+        const auto now = Clock::now();
+        Add(Phase::Frame, frameStart_, now);
+        frameStart_ = now;
+
+        for (std::size_t i = 0; i < PhaseCount; ++i)
+        {
+            // a phase that did not run this frame (no datagrams, no snakes) is not a 0 sample
+            if (!ran_[i])
+                continue;
+
+            auto & history = history_[i];
+            history.ms[history.next] = Ms(frame_[i]);
+            history.next = (history.next + 1) % HistoryFrames;
+            history.size = std::min(history.size + 1, HistoryFrames);
+
+            frame_[i] = {};
+            ran_[i] = false;
+        }
+    }
+
+    FrameProfiler::Stats FrameProfiler::GetStats(const Phase phase) const
+    {
+        const auto & history = history_[static_cast<std::size_t>(phase)];
+        if (history.size == 0)
+            return {};
+
+        std::array<float, HistoryFrames> sorted;
+        std::copy_n(history.ms.begin(), history.size, sorted.begin());
+
+        const auto begin = sorted.begin();
+        const auto end = sorted.begin() + static_cast<std::ptrdiff_t>(history.size);
+
+        auto Percentile = [&](const std::size_t percent)
+        {
+            const auto nth = begin + static_cast<std::ptrdiff_t>((history.size - 1) * percent / 100);
+            std::nth_element(begin, nth, end);
+            return *nth;
+        };
+
+        Stats stats;
+        stats.p50Ms = Percentile(50);
+        stats.p99Ms = Percentile(99);
+        stats.samples = static_cast<std::uint32_t>(history.size);
+        return stats;
+    }
+
+    void FrameProfiler::StartTrace()
+    {
+        trace_.clear();
+        trace_.reserve(64 * 1024);
+        traceStart_ = Clock::now();
+        tracing_ = true;
+    }
+
+    bool FrameProfiler::StopTrace(const std::string & path)
+    {
+        tracing_ = false;
+
+        std::FILE * file = std::fopen(path.c_str(), "wb");
+        if (!file)
+            return false;
+
+        // complete events ("ph":"X"), microseconds since StartTrace()
+        std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+
+        bool first = true;
+
+        for (const auto & event : trace_)
+        {
+            // the frame that was running when the trace started
+            if (event.start < traceStart_)
+                continue;
+
+            const auto ts = std::chrono::duration<double, std::micro>(event.start - traceStart_).count();
+            const auto dur = std::chrono::duration<double, std::micro>(event.duration).count();
+
+            std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}\n",
+                         first ? "" : ",", PhaseName(event.phase), ts, dur);
+            first = false;
+        }
+
+        std::fputs("]}\n", file);
+
+        const bool ok = std::fclose(file) == 0;
+
+        trace_.clear();
+        trace_.shrink_to_fit();
+        return ok;
+    }
+
+} // namespace Core::Components::Profiler
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Core::Components::Profiler {
+
+    // what a frame is split into; scopes of one phase add up within a frame
+    enum class Phase : std::uint8_t
+    {
+        Frame,      // EndFrame() to EndFrame(), vsync wait included
+        NetDrain,
+        Decode,     // inside NetDrain
+        Predict,    // local simulation + prediction correction
+        StaleSweep,
+        Grid,
+        Food,
+        Snakes,
+        Blur,       // inside Snakes
+        UI,
+
+        Count
+    };
+
+    constexpr std::size_t PhaseCount = static_cast<std::size_t>(Phase::Count);
+
+    const char * PhaseName(Phase phase);
+
+    // Main-thread frame timing. Per phase: the time it took in each of the last
+    // HistoryFrames frames, for p50 / p99; optionally every scope as a Chrome trace event
+    // (chrome://tracing, ui.perfetto.dev).
+    class FrameProfiler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t HistoryFrames = 256;
+        static constexpr std::size_t MaxTraceEvents = 1'000'000; // ~24 MB, the rest is dropped
+
+        struct Stats
+        {
+            float p50Ms { 0.f };
+            float p99Ms { 0.f };
+            std::uint32_t samples { 0 };
+        };
+
+        class Scope
+        {
+            FrameProfiler * profiler_;
+            Phase phase_;
+            Clock::time_point start_;
+
+        public:
+            Scope(FrameProfiler & profiler, const Phase phase):
+                profiler_(&profiler), phase_(phase), start_(Clock::now())
+            {
+            }
+
+            Scope(const Scope &) = delete;
+            Scope & operator=(const Scope &) = delete;
+
+            ~Scope()
+            {
+                profiler_->Add(phase_, start_, Clock::now());
+            }
+        };
+
+    private:
+        struct History
+        {
+            std::array<float, HistoryFrames> ms {};
+            std::size_t next { 0 };
+            std::size_t size { 0 };
+        };
+
+        struct TraceEvent
+        {
+            Phase phase;
+            Clock::time_point start;
+            Clock::duration duration;
+        };
+
+        std::array<History, PhaseCount> history_ {};
+        std::array<Clock::duration, PhaseCount> frame_ {};
+        std::array<bool, PhaseCount> ran_ {};
+
+        Clock::time_point frameStart_ { Clock::now() };
+
+        bool tracing_ { false };
+        Clock::time_point traceStart_;
+        std::vector<TraceEvent> trace_;
+
+    public:
+        [[nodiscard]] Scope Measure(const Phase phase)
+        {
+            return { *this, phase };
+        }
+
+        void Add(Phase phase, Clock::time_point start, Clock::time_point end);
+
+        // closes the frame: per phase totals go into the history
+        void EndFrame();
+
+        [[nodiscard]] Stats GetStats(Phase phase) const;
+
+        void StartTrace();
+
+        // writes the collected events to `path` as Chrome trace JSON; false on I/O error
+        bool StopTrace(const std::string & path);
+
+        [[nodiscard]] bool IsTracing() const
+        {
+            return tracing_;
+        }
+    };
+
+    inline FrameProfiler & Profiler()
+    {
+        static FrameProfiler profiler;
+        return profiler;
+    }
+
+} // namespace Core::Components::Profiler
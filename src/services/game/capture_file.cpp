@@ -0,0 +1,134 @@
+#include "capture_file.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Core::App::Game
+{
+    namespace
+    {
+        constexpr std::size_t RecordAlign = 8;
+        constexpr std::size_t WriteBufferBytes = 256 * 1024;
+
+        constexpr std::size_t Padding(const std::size_t bytes)
+        {
+            return (RecordAlign - bytes % RecordAlign) % RecordAlign;
+        }
+    }
+
+    CaptureWriter::~CaptureWriter()
+    {
+        Close();
+    }
+
+    bool CaptureWriter::Open(const std::string & path)
+    {
+        Close();
+
+        file_ = std::fopen(path.c_str(), "wb");
+        if (!file_)
+            return false;
+
+        buffer_.resize(WriteBufferBytes);
+        std::setvbuf(file_, buffer_.data(), _IOFBF, buffer_.size());
+
+        started_ = std::chrono::steady_clock::now();
+
+        CaptureFileHeader header {};
+        std::memcpy(header.magic, CaptureMagic, sizeof(header.magic));
+        header.version = CaptureVersion;
+        header.startedUnixMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        std::fwrite(&header, sizeof(header), 1, file_);
+        return true;
+    }
+
+    void CaptureWriter::Close()
+    {
+        if (!file_)
+            return;
+
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    void CaptureWriter::Write(const CaptureDirection direction,
+                              const std::chrono::steady_clock::time_point time,
+                              const std::span<const std::uint8_t> datagram)
+    {
+        if (!file_)
+            return;
+
+        CaptureRecordHeader record {};
+        record.timeMicros = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(time - started_).count());
+        record.bytes = static_cast<std::uint32_t>(datagram.size());
+        record.direction = direction;
+
+        static constexpr std::uint8_t zeros[RecordAlign] {};
+
+        std::fwrite(&record, sizeof(record), 1, file_);
+        std::fwrite(datagram.data(), 1, datagram.size(), file_);
+        std::fwrite(zeros, 1, Padding(datagram.size()), file_);
+    }
+
+    void CaptureWriter::Flush()
+    {
+        if (file_)
+        {
+            std::fflush(file_);
+        }
+    }
+
+    bool CaptureReader::Open(const std::string & path)
+    {
+        data_.clear();
+        offset_ = 0;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        CaptureFileHeader header {};
+        if (data_.size() < sizeof(header))
+            return false;
+
+        std::memcpy(&header, data_.data(), sizeof(header));
+        if (std::memcmp(header.magic, CaptureMagic, sizeof(header.magic)) != 0 || header.version != CaptureVersion)
+            return false;
+
+        startedUnixMicros_ = header.startedUnixMicros;
+        offset_ = sizeof(header);
+        return true;
+    }
+
+    bool CaptureReader::Next(Record & record)
+    {
+        CaptureRecordHeader header {};
+        if (offset_ + sizeof(header) > data_.size())
+            return false;
+
+        std::memcpy(&header, data_.data() + offset_, sizeof(header));
+
+        const std::size_t begin = offset_ + sizeof(header);
+        if (begin + header.bytes > data_.size())
+            return false;
+
+        record.time = std::chrono::microseconds(header.timeMicros);
+        record.direction = header.direction;
+        record.datagram = std::span<const std::uint8_t>(data_.data() + begin, header.bytes);
+
+        offset_ = begin + header.bytes + Padding(header.bytes);
+        return true;
+    }
+
+    void CaptureReader::Rewind()
+    {
+        offset_ = data_.empty() ? 0 : sizeof(CaptureFileHeader);
+    }
+
+} // namespace Core::App::Game
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Datagram capture: every datagram the UDP client received or sent, with its time.
+    // Layout (native endian, append-only, every record 8-byte aligned so the file can be
+    // mapped and walked in place):
+    //   CaptureFileHeader
+    //   { CaptureRecordHeader, datagram bytes, zero padding to 8 } ...
+    // A record cut short by a crash ends the file, everything before it stays readable.
+
+    enum class CaptureDirection : std::uint8_t
+    {
+        Inbound = 0,  // server -> client, as received (bad datagrams included)
+        Outbound = 1, // client -> server
+    };
+
+    struct CaptureFileHeader
+    {
+        char magic[8];                     // "SNKCAP\0\0"
+        std::uint32_t version;
+        std::uint32_t reserved;
+        std::int64_t startedUnixMicros;    // wall clock of time 0, for matching server logs
+    };
+
+    struct CaptureRecordHeader
+    {
+        std::uint64_t timeMicros;          // since the capture started (steady clock)
+        std::uint32_t bytes;               // datagram size, padding not included
+        CaptureDirection direction;
+        std::uint8_t reserved[3];
+    };
+
+    static_assert(sizeof(CaptureFileHeader) == 24);
+    static_assert(sizeof(CaptureRecordHeader) == 16);
+
+    constexpr char CaptureMagic[8] = { 'S', 'N', 'K', 'C', 'A', 'P', 0, 0 };
+    constexpr std::uint32_t CaptureVersion = 1;
+
+    // network thread only
+    class CaptureWriter
+    {
+        std::FILE * file_ { nullptr };
+        std::chrono::steady_clock::time_point started_;
+        std::vector<char> buffer_;
+
+    public:
+        CaptureWriter() = default;
+        CaptureWriter(const CaptureWriter &) = delete;
+        CaptureWriter & operator=(const CaptureWriter &) = delete;
+
+        ~CaptureWriter();
+
+        // truncates `path`; false when it cannot be created
+        bool Open(const std::string & path);
+
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const
+        {
+            return file_ != nullptr;
+        }
+
+        void Write(CaptureDirection direction, std::chrono::steady_clock::time_point time, std::span<const std::uint8_t> datagram);
+
+        // buffered records to disk; cheap when nothing is buffered
+        void Flush();
+    };
+
+    class CaptureReader
+    {
+    public:
+        struct Record
+        {
+            std::chrono::microseconds time { 0 };
+            CaptureDirection direction { CaptureDirection::Inbound };
+            std::span<const std::uint8_t> datagram; // valid while the reader lives
+        };
+
+    private:
+        std::vector<std::uint8_t> data_;
+        std::size_t offset_ { 0 };
+        std::int64_t startedUnixMicros_ { 0 };
+
+    public:
+        // loads the whole file; false when it is missing or not a capture
+        bool Open(const std::string & path);
+
+        // false at the end of the file (or at a truncated record)
+        bool Next(Record & record);
+
+        void Rewind();
+
+        [[nodiscard]] std::int64_t StartedUnixMicros() const
+        {
+            return startedUnixMicros_;
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,267 @@
+#include "drift_validation.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define SNAKE_DRIFT_X86 1
+#endif
+
+namespace Core::App::Game
+{
+    namespace Detail
+    {
+        std::size_t FindBeyondScalar(const float* xs, const float* ys, std::size_t begin, const std::size_t count,
+                                     const float lx, const float ly, const float minDistSq)
+        {
+            for (; begin < count; ++begin)
+            {
+                const float dx = xs[begin] - lx;
+                const float dy = ys[begin] - ly;
+
+                if (dx * dx + dy * dy >= minDistSq)
+                    return begin;
+            }
+
+            return count;
+        }
+
+#ifdef SNAKE_DRIFT_X86
+        static std::size_t FindBeyondSse2(const float* xs, const float* ys, std::size_t begin, const std::size_t count,
+                                          const float lx, const float ly, const float minDistSq)
+        {
+            const __m128 vlx = _mm_set1_ps(lx);
+            const __m128 vly = _mm_set1_ps(ly);
+            const __m128 vmin = _mm_set1_ps(minDistSq);
+
+            for (; begin + 4 <= count; begin += 4)
+            {
+                const __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + begin), vlx);
+                const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + begin), vly);
+                const __m128 d = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+                const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmpge_ps(d, vmin)));
+                if (mask)
+                    return begin + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+
+            return FindBeyondScalar(xs, ys, begin, count, lx, ly, minDistSq);
+        }
+
+        __attribute__((target("avx2")))
+        static std::size_t FindBeyondAvx2(const float* xs, const float* ys, std::size_t begin, const std::size_t count,
+                                          const float lx, const float ly, const float minDistSq)
+        {
+            const __m256 vlx = _mm256_set1_ps(lx);
+            const __m256 vly = _mm256_set1_ps(ly);
+            const __m256 vmin = _mm256_set1_ps(minDistSq);
+
+            for (; begin + 8 <= count; begin += 8)
+            {
+                const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + begin), vlx);
+                const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + begin), vly);
+                const __m256 d = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+                const auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(d, vmin, _CMP_GE_OQ)));
+                if (mask)
+                    return begin + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+
+            return FindBeyondSse2(xs, ys, begin, count, lx, ly, minDistSq);
+        }
+#endif
+
+        using FindBeyondFn = std::size_t (*)(const float*, const float*, std::size_t, std::size_t, float, float, float);
+
+        static FindBeyondFn ResolveFindBeyond()
+        {
+#ifdef SNAKE_DRIFT_X86
+            if (__builtin_cpu_supports("avx2"))
+                return &FindBeyondAvx2;
+
+            return &FindBeyondSse2;
+#else
+            return &FindBeyondScalar;
+#endif
+        }
+
+        std::size_t FindBeyond(const float* xs, const float* ys, const std::size_t begin, const std::size_t count,
+                               const float lx, const float ly, const float minDistSq)
+        {
+            static const FindBeyondFn impl = ResolveFindBeyond();
+            return impl(xs, ys, begin, count, lx, ly, minDistSq);
+        }
+    }
+
+    bool ValidateSamplesByRadius(const SegmentRing& predicted,
+                                 const std::span<const sf::Vector2f> serverSamples,
+                                 const float minDist,
+                                 const float threshold)
+    {
+        if (serverSamples.empty())
+        {
+            return true;
+        }
+
+        if (predicted.empty())
+        {
+            return false;
+        }
+
+        const std::size_t n = serverSamples.size();
+        const std::size_t allowed = std::max<std::size_t>(2, n / 10);
+
+        const float minDistSq = minDist * minDist;
+        const float thresholdSq = threshold * threshold;
+
+        std::size_t k = 0;
+        std::size_t bad = 0;
+
+        // compares the next resampled point with serverSamples[k]; false = snake already failed
+        auto Emit = [&](const float x, const float y) -> bool
+        {
+            if (k == n)
+                return false; // more expected samples than the server sent
+
+            const float dx = x - serverSamples[k].x;
+            const float dy = y - serverSamples[k].y;
+            k++;
+
+            return !(dx * dx + dy * dy > thresholdSq) || ++bad <= allowed;
+        };
+
+        const auto head = predicted.front();
+        float lx = head.x;
+        float ly = head.y;
+
+        if (!Emit(lx, ly))
+        {
+            return false;
+        }
+
+        const auto runs = predicted.Runs();
+        for (std::size_t r = 0; r < runs.size(); ++r)
+        {
+            const float* xs = runs[r].xs.data();
+            const float* ys = runs[r].ys.data();
+            const std::size_t count = runs[r].xs.size();
+
+            // the head is the first element of the first run
+            std::size_t i = (r == 0) ? 1 : 0;
+
+            while ((i = Detail::FindBeyond(xs, ys, i, count, lx, ly, minDistSq)) < count)
+            {
+                lx = xs[i];
+                ly = ys[i];
+
+                if (!Emit(lx, ly))
+                {
+                    return false;
+                }
+
+                ++i;
+            }
+        }
+
+        // tail is always part of the server samples
+        if (predicted.size() >= 2)
+        {
+            const auto tail = predicted.back();
+            if ((lx != tail.x || ly != tail.y) && !Emit(tail.x, tail.y))
+            {
+                return false;
+            }
+        }
+
+        return k == n;
+    }
+
+    void BuildExpectedSamplesByRadius(const SegmentRing& segments,
+                                      const float minDist,
+                                      std::vector<sf::Vector2f>& out)
+    {
+        out.clear();
+
+        if (segments.empty())
+        {
+            return;
+        }
+
+        out.reserve(segments.size());
+
+        auto it = segments.begin();
+        sf::Vector2f last = *it;
+        out.push_back(last);
+
+        for (++it; it != segments.end(); ++it)
+        {
+            const auto p = *it;
+            const float dx = p.x - last.x;
+            const float dy = p.y - last.y;
+            const float dist = std::hypot(dx, dy);
+
+            if (dist >= minDist)
+            {
+                out.push_back(p);
+                last = p;
+            }
+        }
+
+        // ensure tail included
+        if (segments.size() >= 2)
+        {
+            const auto tail = segments.back();
+            if (out.back().x != tail.x || out.back().y != tail.y)
+            {
+                out.push_back(tail);
+            }
+        }
+    }
+
+    bool ValidateSamplesByRadiusTwoPass(const SegmentRing& predicted,
+                                        const std::span<const sf::Vector2f> serverSamples,
+                                        const float minDist,
+                                        const float threshold,
+                                        std::vector<sf::Vector2f>& expectedScratch)
+    {
+        if (serverSamples.empty())
+        {
+            return true;
+        }
+
+        BuildExpectedSamplesByRadius(predicted, minDist, expectedScratch);
+        const auto& expected = expectedScratch;
+
+        if (expected.size() != serverSamples.size())
+        {
+            return false;
+        }
+
+        std::size_t bad = 0;
+        const std::size_t n = expected.size();
+
+        const std::size_t allowed = std::max<std::size_t>(2, n / 10);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const float dx = expected[i].x - serverSamples[i].x;
+            const float dy = expected[i].y - serverSamples[i].y;
+
+            const float dist = std::hypot(dx, dy);
+
+            if (dist > threshold)
+            {
+                bad++;
+                if (bad > allowed)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+} // namespace Core::App::Game
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "segment_ring.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Drift check for partial updates: the server sends the snake body resampled every
+    // `minDist` (head first, tail always included); the client resamples its own body the
+    // same way and the snake fails when the counts differ or more than max(2, n / 10)
+    // samples are further than `threshold` apart.
+
+    // resample + compare in one pass over squared distances, no intermediate buffer;
+    // the "next point beyond minDist" scan uses AVX2 / SSE2 when available
+    bool ValidateSamplesByRadius(const SegmentRing& predicted,
+                                 std::span<const sf::Vector2f> serverSamples,
+                                 float minDist,
+                                 float threshold);
+
+    // reference two-pass version (materialised resample, hypot per point), kept for benchmarks
+    bool ValidateSamplesByRadiusTwoPass(const SegmentRing& predicted,
+                                        std::span<const sf::Vector2f> serverSamples,
+                                        float minDist,
+                                        float threshold,
+                                        std::vector<sf::Vector2f>& expectedScratch);
+
+    void BuildExpectedSamplesByRadius(const SegmentRing& segments,
+                                      float minDist,
+                                      std::vector<sf::Vector2f>& out);
+
+    namespace Detail
+    {
+        // first index in [begin, count) with (x - lx)^2 + (y - ly)^2 >= minDistSq, or count
+        std::size_t FindBeyond(const float* xs, const float* ys, std::size_t begin, std::size_t count,
+                               float lx, float ly, float minDistSq);
+
+        std::size_t FindBeyondScalar(const float* xs, const float* ys, std::size_t begin, std::size_t count,
+                                     float lx, float ly, float minDistSq);
+    }
+
+} // namespace Core::App::Game
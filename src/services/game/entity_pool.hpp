@@ -0,0 +1,169 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Free list of equally sized blocks carved out of larger chunks.
+    // The block size is fixed by the first allocation (allocate_shared always asks
+    // for the same control block + object size); other sizes go to the global heap.
+    class BlockPool
+    {
+        struct FreeBlock
+        {
+            FreeBlock * next;
+        };
+
+        static constexpr std::size_t Align = alignof(std::max_align_t);
+
+        std::size_t blockSize_ { 0 };
+        std::size_t blocksPerChunk_;
+
+        std::vector<std::unique_ptr<std::byte[]>> chunks_;
+        FreeBlock * freeList_ { nullptr };
+
+        std::size_t blocksInUse_ { 0 };
+
+    public:
+        explicit BlockPool(const std::size_t blocksPerChunk): blocksPerChunk_(blocksPerChunk) {}
+
+        BlockPool(const BlockPool &) = delete;
+        BlockPool & operator=(const BlockPool &) = delete;
+
+        void * Allocate(const std::size_t bytes)
+        {
+            if (blockSize_ == 0)
+            {
+                blockSize_ = std::max(RoundUp(bytes), RoundUp(sizeof(FreeBlock)));
+            }
+
+            if (RoundUp(bytes) > blockSize_)
+            {
+                return ::operator new(bytes);
+            }
+
+            if (!freeList_)
+            {
+                Grow();
+            }
+
+            auto block = freeList_;
+            freeList_ = block->next;
+            blocksInUse_++;
+
+            return block;
+        }
+
+        void Deallocate(void * ptr, const std::size_t bytes)
+        {
+            if (RoundUp(bytes) > blockSize_)
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            auto block = static_cast<FreeBlock *>(ptr);
+            block->next = freeList_;
+            freeList_ = block;
+            blocksInUse_--;
+        }
+
+        [[nodiscard]] std::size_t BlocksInUse() const
+        {
+            return blocksInUse_;
+        }
+
+        [[nodiscard]] std::size_t BlocksReserved() const
+        {
+            return chunks_.size() * blocksPerChunk_;
+        }
+
+    private:
+        static std::size_t RoundUp(const std::size_t bytes)
+        {
+            return (bytes + Align - 1) / Align * Align;
+        }
+
+        void Grow()
+        {
+            auto & chunk = chunks_.emplace_back(new std::byte[blockSize_ * blocksPerChunk_]);
+
+            for (std::size_t i = blocksPerChunk_; i-- > 0; )
+            {
+                auto block = reinterpret_cast<FreeBlock *>(chunk.get() + i * blockSize_);
+                block->next = freeList_;
+                freeList_ = block;
+            }
+        }
+    };
+
+    // std allocator over a shared BlockPool. Every shared_ptr made through it keeps the
+    // pool alive, so entities still referenced by Logic or the renderer stay valid after
+    // the owner of the pool is gone.
+    template <class T>
+    class PoolAllocator
+    {
+        template <class U>
+        friend class PoolAllocator;
+
+        std::shared_ptr<BlockPool> pool_;
+
+    public:
+        using value_type = T;
+
+        explicit PoolAllocator(std::shared_ptr<BlockPool> pool): pool_(std::move(pool)) {}
+
+        template <class U>
+        PoolAllocator(const PoolAllocator<U> & other): pool_(other.pool_) {}
+
+        T * allocate(const std::size_t n)
+        {
+            return static_cast<T *>(pool_->Allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T * ptr, const std::size_t n)
+        {
+            pool_->Deallocate(ptr, n * sizeof(T));
+        }
+
+        template <class U>
+        bool operator==(const PoolAllocator<U> & other) const
+        {
+            return pool_ == other.pool_;
+        }
+    };
+
+    template <class T>
+    class EntityPool
+    {
+        std::shared_ptr<BlockPool> pool_;
+
+    public:
+        explicit EntityPool(const std::size_t blocksPerChunk = 256):
+            pool_(std::make_shared<BlockPool>(blocksPerChunk))
+        {
+        }
+
+        template <class... Args>
+        std::shared_ptr<T> Make(Args &&... args)
+        {
+            return std::allocate_shared<T>(PoolAllocator<T>(pool_), std::forward<Args>(args)...);
+        }
+
+        [[nodiscard]] std::size_t InUse() const
+        {
+            return pool_->BlocksInUse();
+        }
+
+        [[nodiscard]] std::size_t Reserved() const
+        {
+            return pool_->BlocksReserved();
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Sparse set keyed by server entity ID.
+    // Records live in one dense vector (swap-remove on erase), the ID -> dense index
+    // lookup is a paged array, so find / insert / erase are O(1) without hashing.
+    template <class Record>
+    class EntityRegistry
+    {
+    private:
+        static constexpr std::uint32_t PageBits = 12;
+        static constexpr std::uint32_t PageSize = 1u << PageBits;
+        static constexpr std::uint32_t PageMask = PageSize - 1;
+        static constexpr std::uint32_t Npos = std::numeric_limits<std::uint32_t>::max();
+
+        // dense index of the entity's record, Npos when absent
+        using Page = std::array<std::uint32_t, PageSize>;
+
+        std::vector<std::unique_ptr<Page>> pages_;
+
+        std::vector<Record> records_;
+        std::vector<std::uint32_t> ids_;
+
+    public:
+        [[nodiscard]] std::size_t Size() const
+        {
+            return records_.size();
+        }
+
+        [[nodiscard]] bool Empty() const
+        {
+            return records_.empty();
+        }
+
+        Record * Find(const std::uint32_t entityID)
+        {
+            const auto slot = FindSlot(entityID);
+            if (!slot || *slot == Npos)
+                return nullptr;
+
+            return &records_[*slot];
+        }
+
+        const Record * Find(const std::uint32_t entityID) const
+        {
+            const auto slot = FindSlot(entityID);
+            if (!slot || *slot == Npos)
+                return nullptr;
+
+            return &records_[*slot];
+        }
+
+        Record & GetOrCreate(const std::uint32_t entityID)
+        {
+            auto & slot = AcquireSlot(entityID);
+
+            if (slot == Npos)
+            {
+                slot = static_cast<std::uint32_t>(records_.size());
+                records_.emplace_back();
+                ids_.push_back(entityID);
+            }
+
+            return records_[slot];
+        }
+
+        bool Erase(const std::uint32_t entityID)
+        {
+            const auto slot = FindSlot(entityID);
+            if (!slot || *slot == Npos)
+                return false;
+
+            EraseDense(*slot);
+            return true;
+        }
+
+        // pred(entityID, record) -> true to erase; walks the dense array back to front
+        template <class Pred>
+        std::size_t EraseIf(Pred && pred)
+        {
+            std::size_t erased = 0;
+
+            for (std::size_t i = records_.size(); i-- > 0; )
+            {
+                if (pred(ids_[i], records_[i]))
+                {
+                    EraseDense(static_cast<std::uint32_t>(i));
+                    erased++;
+                }
+            }
+
+            return erased;
+        }
+
+        void Clear()
+        {
+            for (const auto id : ids_)
+            {
+                (*pages_[id >> PageBits])[id & PageMask] = Npos;
+            }
+
+            records_.clear();
+            ids_.clear();
+        }
+
+        [[nodiscard]] std::span<Record> Records()
+        {
+            return records_;
+        }
+
+        [[nodiscard]] std::span<const Record> Records() const
+        {
+            return records_;
+        }
+
+    private:
+        const std::uint32_t * FindSlot(const std::uint32_t entityID) const
+        {
+            const std::size_t page = entityID >> PageBits;
+            if (page >= pages_.size() || !pages_[page])
+                return nullptr;
+
+            return &(*pages_[page])[entityID & PageMask];
+        }
+
+        std::uint32_t * FindSlot(const std::uint32_t entityID)
+        {
+            return const_cast<std::uint32_t *>(std::as_const(*this).FindSlot(entityID));
+        }
+
+        std::uint32_t & AcquireSlot(const std::uint32_t entityID)
+        {
+            const std::size_t page = entityID >> PageBits;
+            if (page >= pages_.size())
+                pages_.resize(page + 1);
+
+            if (!pages_[page])
+            {
+                pages_[page] = std::make_unique<Page>();
+                pages_[page]->fill(Npos);
+            }
+
+            return (*pages_[page])[entityID & PageMask];
+        }
+
+        void EraseDense(const std::uint32_t dense)
+        {
+            const auto id = ids_[dense];
+            const auto last = static_cast<std::uint32_t>(records_.size() - 1);
+
+            if (dense != last)
+            {
+                records_[dense] = std::move(records_[last]);
+                ids_[dense] = ids_[last];
+
+                (*pages_[ids_[dense] >> PageBits])[ids_[dense] & PageMask] = dense;
+            }
+
+            records_.pop_back();
+            ids_.pop_back();
+
+            (*pages_[id >> PageBits])[id & PageMask] = Npos;
+        }
+    };
+
+} // namespace Core::App::Game
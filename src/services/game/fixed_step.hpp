@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace Core::App::Game
+{
+    // Fixed timestep accumulator: wall time goes in, a whole number of ticks comes out.
+    // The leftover fraction of a tick is Alpha() and is what rendering interpolates with.
+    // After a long stall at most maxCatchUp ticks run, the rest of the debt is dropped.
+    class FixedStep
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+    private:
+        Clock::duration step_;
+        Clock::duration accumulator_ { 0 };
+        Clock::time_point last_;
+        bool started_ { false };
+
+        std::uint32_t maxCatchUp_;
+        std::uint64_t droppedTicks_ { 0 };
+
+    public:
+        explicit FixedStep(const std::uint32_t hz, const std::uint32_t maxCatchUp = 8):
+            step_(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1'000'000'000 / hz))),
+            maxCatchUp_(maxCatchUp)
+        {
+        }
+
+        // ticks due since the previous call (0 on the first call)
+        std::uint32_t Advance(const Clock::time_point now)
+        {
+            if (!started_)
+            {
+                started_ = true;
+                last_ = now;
+                return 0;
+            }
+
+            accumulator_ += std::max(now - last_, Clock::duration::zero());
+            last_ = now;
+
+            auto ticks = static_cast<std::uint64_t>(accumulator_ / step_);
+            accumulator_ -= step_ * static_cast<Clock::rep>(ticks);
+
+            if (ticks > maxCatchUp_)
+            {
+                droppedTicks_ += ticks - maxCatchUp_;
+                ticks = maxCatchUp_;
+            }
+
+            return static_cast<std::uint32_t>(ticks);
+        }
+
+        // [0, 1): how far wall time is into the next tick
+        [[nodiscard]] float Alpha() const
+        {
+            return std::chrono::duration<float>(accumulator_) / std::chrono::duration<float>(step_);
+        }
+
+        [[nodiscard]] Clock::duration Step() const
+        {
+            return step_;
+        }
+
+        [[nodiscard]] std::uint64_t DroppedTicks() const
+        {
+            return droppedTicks_;
+        }
+    };
+
+} // namespace Core::App::Game
@@ -1,21 +1,34 @@
 #include "game_client.hpp"
 
+#include <charconv>
 #include <cmath>
+#include <optional>
 #include <utility>
 #include <vector>
 #include <algorithm>
 
 #include "utils.hpp"
+#include "legacy_game_math.hpp"
+
+#include "components/profiler/profiler.hpp"
 
 using namespace std::chrono_literals;
 
+using Core::Components::Profiler::Profiler;
+using Core::Components::Profiler::Phase;
+
 namespace Core::App::Game
 {
-    GameClient::GameClient()
+    // ~ one camera radius per cell at zoom 1: a view query touches a handful of cells
+    constexpr float GridCellSize = 768.f;
+
+    GameClient::GameClient():
+        snakeGrid_(Utils::Legacy::Game::AreaCenter, Utils::Legacy::Game::AreaRadius, GridCellSize),
+        foodGrid_(Utils::Legacy::Game::AreaCenter, Utils::Legacy::Game::AreaRadius, GridCellSize)
     {
     }
 
-    void GameClient::Initialise(const std::uint8_t serverID)
+    void GameClient::Initialise(const std::uint8_t serverID, const std::uint32_t ioThreads)
     {
         auto host = Utils::Env("WS_HOST");
         if (host.empty())
@@ -25,44 +38,101 @@ namespace Core::App::Game
         cfg.host = host;
         cfg.port = 7777 + serverID;
         cfg.mode = Utils::Net::Udp::Mode::Bytes;
-        cfg.ioThreads = 2;
+        cfg.ioThreads = static_cast<int>(std::max<std::uint32_t>(ioThreads, 1));
+
+        // remote snake interpolation delay override, ms
+        const auto delay = Utils::Env("SNAKE_INTERP_DELAY_MS");
+        if (int delayMs = 0; std::from_chars(delay.data(), delay.data() + delay.size(), delayMs).ec == std::errc{})
+        {
+            SetInterpolationDelay(std::chrono::milliseconds(delayMs));
+        }
+
+        netWorker_ = std::make_shared<NetWorker>();
+
+        // datagram capture for replay (snake-app-replay)
+        if (const auto capturePath = Utils::Env("SNAKE_CAPTURE"); !capturePath.empty())
+        {
+            if (netWorker_->StartCapture(capturePath))
+                Log()->Warning("[Net] Capturing datagrams to '{}'", capturePath);
+            else
+                Log()->Error("[Net] Cannot open capture file '{}'", capturePath);
+        }
+
+        netWorker_->Start(cfg);
+    }
 
-        udpClient_ = UdpClient::Create(cfg, shared_from_this());
+    GameClient::~GameClient()
+    {
+        if (netWorker_)
+        {
+            netWorker_->Stop();
+        }
     }
 
     void GameClient::ProcessTick()
     {
-        Logic::ProcessTick();
+        AdvanceTo(FixedStep::Clock::now());
+    }
+
+    void GameClient::AdvanceTo(const FixedStep::Clock::time_point now)
+    {
+        now_ = now;
+
+        // network is drained every loop iteration, the simulation only on whole 64 Hz ticks
+        DrainNetEvents();
+
+        // holes in the update stream that did not fill in time are lost
+        if (const auto expired = updateWindow_.ExpiredThrough(now, ReorderTimeout))
+        {
+            DrainReorderWindow(expired);
+        }
+
+        const auto ticks = fixedStep_.Advance(now);
+        if (ticks > 0)
+        {
+            // the oldest tick was due (ticks - 1) steps plus the leftover ago
+            tickLateMs_ = std::chrono::duration<float, std::milli>(fixedStep_.Step()).count()
+                          * (static_cast<float>(ticks - 1) + fixedStep_.Alpha());
+        }
+
+        for (std::uint32_t i = 0; i < ticks; ++i)
+        {
+            Step();
+        }
+    }
 
-        if (udpClient_)
+    void GameClient::Step()
+    {
         {
-            udpClient_->ProcessTick();
+            const auto timer = Profiler().Measure(Phase::Predict);
+
+            ApplyPredictionCorrection();
+
+            Logic::ProcessTick();
+
+            // the local simulation only moves the player; remote bodies change through Net* calls
+            if (const auto rec = snakeRecords_.Find(playerEntityID_); rec && rec->snake)
+            {
+                SyncBodyStep(*rec);
+            }
         }
 
         // send input at 32 tickrate (logic tick 64)
         if (frame_ % 2 == 0)
         {
+            std::optional<std::size_t> inputIndex;
+
             if (clientSnake_)
             {
                 using namespace Utils::Legacy::Game::Net;
 
-                ByteWriter payload(sizeof(ClientInputPayload));
-
                 ClientInputPayload input{};
                 input.destinationX = clientSnake_->GetDestination().x;
                 input.destinationY = clientSnake_->GetDestination().y;
                 input.clientFrame  = frame_;
 
-                payload.WritePod(input);
-
-                net_.lastInputSeq++;
-
-                const auto msg = BuildMessage(MessageType::ClientInput,
-                                              net_.lastInputSeq,
-                                              0,
-                                              payload.Data());
-
-                udpClient_->Send(msg);
+                inputIndex = outgoing_.Begin(MessageType::ClientInput);
+                outgoing_.WritePod(input);
             }
 
             // pending full update request
@@ -70,66 +140,67 @@ namespace Core::App::Game
             {
                 using namespace Utils::Legacy::Game::Net;
 
-                ByteWriter payload(sizeof(RequestFullUpdatePayload));
-
                 RequestFullUpdatePayload rq{};
                 if (net_.pendingFullRequestAllSegments)
                 {
                     rq.flags |= RequestFullUpdateFlag_AllSegments;
                 }
 
-                payload.WritePod(rq);
-
-                net_.lastInputSeq++;
-
-                const auto msg = BuildMessage(MessageType::RequestFullUpdate,
-                                              net_.lastInputSeq,
-                                              0,
-                                              payload.Data());
-
-                udpClient_->Send(msg);
+                outgoing_.Begin(MessageType::RequestFullUpdate);
+                outgoing_.WritePod(rq);
 
                 net_.pendingFullRequest = false;
                 net_.pendingFullRequestAllSegments = false;
+                fullRequestsSent_++;
             }
 
-            // pending snake snapshot requests (pointed repair)
-            if (!pendingSnakeSnapshots_.empty())
+            // receive state of the update stream, the server builds deltas against it
+            if (net_.serverFeatures & Net::ServerFeature_AckedUpdates)
             {
-                using namespace Utils::Legacy::Game::Net;
-
-                std::uint32_t sent = 0;
-                constexpr std::uint32_t perTickLimit = 16;
+                SendUpdateAck();
+            }
 
-                for (auto it = pendingSnakeSnapshots_.begin(); it != pendingSnakeSnapshots_.end() && sent < perTickLimit; )
-                {
-                    const auto entityID = *it;
+            // selective repair of a chunked full update
+            if (chunks_.active)
+            {
+                NackMissingChunks();
+            }
 
-                    net_.lastInputSeq++;
+            // pending snake snapshot requests (pointed repair)
+            ExpireSnakeSnapshotRequests();
 
-                    ByteWriter payload(sizeof(RequestSnakeSnapshotPayload));
-                    RequestSnakeSnapshotPayload rq{};
-                    rq.entityID = entityID;
-                    payload.WritePod(rq);
+            if (!pendingSnakeSnapshots_.empty())
+            {
+                SendSnakeSnapshotRequests();
+            }
 
-                    const auto msg = BuildMessage(MessageType::RequestSnakeSnapshot,
-                                                  net_.lastInputSeq,
-                                                  0,
-                                                  payload.Data());
-                    udpClient_->Send(msg);
+            FlushOutgoing();
 
-                    it = pendingSnakeSnapshots_.erase(it);
-                    sent++;
-                }
+            // the input is matched to acks by the seq it actually went out with
+            if (inputIndex)
+            {
+                prediction_.inputs.Push({
+                    .seq = outgoing_.SeqOf(*inputIndex),
+                    .clientFrame = frame_,
+                    .destination = clientSnake_->GetDestination(),
+                    .head = clientSnake_->GetPosition(),
+                    .correction = prediction_.applied,
+                });
             }
         }
 
-        // ===================== stale entity cleanup =====================
+        SweepStaleEntities();
+    }
+
+    void GameClient::SweepStaleEntities()
+    {
         if (!clientSnake_)
         {
             return;
         }
 
+        const auto timer = Profiler().Measure(Phase::StaleSweep);
+
         constexpr std::uint32_t ttlSeqDelta = 8;
         const std::uint32_t currentSeq = net_.lastServerSeq;
 
@@ -137,92 +208,125 @@ namespace Core::App::Game
         const float radius = GetVisibleRadiusWithPadding();
         const float radiusSq = radius * radius;
 
-        for (auto it = foodsByID_.begin(); it != foodsByID_.end(); )
+        auto IsStale = [&](const std::uint32_t lastSeen)
         {
-            const auto id = it->first;
-            const auto food = it->second;
+            return (currentSeq > lastSeen) && ((currentSeq - lastSeen) >= ttlSeqDelta);
+        };
 
-            const bool wasSeen = foodsTTL_.contains(id);
-            const std::uint32_t lastSeen = wasSeen ? foodsTTL_[id].lastSeenSeq : 0;
-            const bool stale = wasSeen && (currentSeq > lastSeen) && ((currentSeq - lastSeen) >= ttlSeqDelta);
+        auto IsFar = [&](const sf::Vector2f& pos)
+        {
+            const float dx = pos.x - playerPos.x;
+            const float dy = pos.y - playerPos.y;
+            return (dx * dx + dy * dy) > radiusSq;
+        };
 
-            bool far = true;
-            if (food)
-            {
-                const auto pos = food->GetPosition();
-                const float dx = pos.x - playerPos.x;
-                const float dy = pos.y - playerPos.y;
-                far = (dx * dx + dy * dy) > radiusSq;
-            }
+        foodRecords_.EraseIf([&](const std::uint32_t id, FoodRecord& rec)
+        {
+            if (!IsStale(rec.lastSeenSeq))
+                return false;
 
-            if (stale && far)
+            if (rec.food)
             {
-                if (food)
-                {
-                    foods_.erase(food);
-                }
+                if (!IsFar(rec.food->GetPosition()))
+                    return false;
 
-                foodsTTL_.erase(id);
-                it = foodsByID_.erase(it);
-                continue;
+                foods_.erase(rec.food);
             }
 
-            ++it;
-        }
+            foodGrid_.Remove(id, rec.cells);
+            return true;
+        });
 
-        for (auto it = snakesByID_.begin(); it != snakesByID_.end(); )
+        snakeRecords_.EraseIf([&](const std::uint32_t id, SnakeRecord& rec)
         {
-            const auto id = it->first;
-
             if (id == playerEntityID_)
-            {
-                ++it;
-                continue;
-            }
+                return false;
 
-            const auto snake = it->second;
+            // snapshot-only record: drop once its cooldown ran out (request may be queued again)
+            if (!rec.snake)
+                return frame_ >= rec.snapshotCooldownFrame;
 
-            const bool wasSeen = snakesTTL_.contains(id);
-            const std::uint32_t lastSeen = wasSeen ? snakesTTL_[id].lastSeenSeq : 0;
-            const bool stale = wasSeen && (currentSeq > lastSeen) && ((currentSeq - lastSeen) >= ttlSeqDelta);
+            if (!IsStale(rec.lastSeenSeq) || !IsFar(rec.snake->GetPosition()))
+                return false;
 
-            bool far = true;
-            if (snake)
-            {
-                const auto pos = snake->GetPosition();
-                const float dx = pos.x - playerPos.x;
-                const float dy = pos.y - playerPos.y;
-                far = (dx * dx + dy * dy) > radiusSq;
-            }
+            snakes_.erase(rec.snake);
+            snakeGrid_.Remove(id, rec.cells);
+            return true;
+        });
+    }
+
+    void GameClient::DrainNetEvents()
+    {
+        if (!netWorker_)
+        {
+            return;
+        }
+
+        const auto timer = Profiler().Measure(Phase::NetDrain);
 
-            if (stale && far)
+        netWorker_->Drain([this](const NetEvent& event)
+        {
+            switch (event.kind)
             {
-                if (snake)
+                case NetEvent::Kind::Connected:
+                    OnConnected(event.sessionID);
+                    break;
+                case NetEvent::Kind::Disconnected:
+                    OnDisconnected();
+                    break;
+                case NetEvent::Kind::ConnectionError:
+                    OnConnectionError(event.error, event.reconnect);
+                    break;
+                case NetEvent::Kind::BadDatagram:
+                    ReportBadDatagram(event.check);
+                    break;
+                case NetEvent::Kind::Datagram:
                 {
-                    snakes_.erase(snake);
-                }
+                    const auto started = std::chrono::steady_clock::now();
 
-                snakesTTL_.erase(id);
-                predict_.erase(id);
-                snakeSnapshotCooldownFrame_.erase(id);
+                    messageTime_ = event.receivedAt;
+                    HandleMessage(event.check.header, event.payload, event.check.bytes);
 
-                it = snakesByID_.erase(it);
-                continue;
+                    const auto finished = std::chrono::steady_clock::now();
+                    decodeTime_ += finished - started;
+                    Profiler().Add(Phase::Decode, started, finished);
+                    break;
+                }
             }
+        });
+    }
 
-            ++it;
+    void GameClient::Send(const std::span<const std::uint8_t> message)
+    {
+        if (netWorker_)
+        {
+            netWorker_->Send(message);
         }
     }
 
-    void GameClient::OnConnected()
+    void GameClient::FlushOutgoing()
+    {
+        const bool bundled = (net_.serverFeatures & Net::ServerFeature_Bundle) != 0;
+
+        outgoing_.Flush(bundled, net_.lastInputSeq, [this](const std::vector<std::uint8_t>& msg)
+        {
+            Send(msg);
+        });
+    }
+
+    void GameClient::OnConnected(const std::uint64_t sessionID)
     {
         ClearWorld();
 
+        // capabilities and link estimates belong to the session
+        net_.serverFeatures = Net::ServerFeature_None;
+        snapshotPacer_.Reset();
+
         connected_ = true;
 
         if (connectCallback_)
         {
-            connectCallback_(udpClient_->SessionID());
+            connectCallback_(sessionID);
             connectCallback_ = {};
         }
     }
@@ -239,111 +343,247 @@ namespace Core::App::Game
         Log()->Error("Connection error: {}", error);
     }
 
-    void GameClient::OnMessage(const std::vector<std::uint8_t>& data)
+    void GameClient::HandleDatagram(const std::span<const std::uint8_t> data, const SnapshotBuffer::Clock::time_point receivedAt)
     {
-        using namespace Utils::Legacy::Game::Net;
+        const auto check = CheckDatagram(data);
+        if (!check.Ok())
+        {
+            ReportBadDatagram(check);
+            return;
+        }
 
-        MessageHeader header{};
-        const auto parseErr = ParseHeaderDetailed(std::span(data.data(), data.size()), header);
+        const auto started = std::chrono::steady_clock::now();
 
-        if (parseErr != ParseError::Ok)
-        {
-            badPacketsDropped_++;
+        messageTime_ = receivedAt;
+        HandleMessage(check.header,
+                      data.subspan(sizeof(Utils::Legacy::Game::Net::MessageHeader), check.header.payloadBytes),
+                      data.size());
 
-            // try best-effort to read type/seq from bytes when possible
-            std::uint16_t typeRaw = 0;
-            std::uint32_t seqRaw = 0;
-            if (data.size() >= sizeof(MessageHeader))
-            {
-                std::memcpy(&typeRaw, data.data() + 0, sizeof(typeRaw));
-                std::memcpy(&seqRaw, data.data() + 4, sizeof(seqRaw)); // after type+version (4 bytes)
-            }
+        const auto finished = std::chrono::steady_clock::now();
+        decodeTime_ += finished - started;
+        Profiler().Add(Phase::Decode, started, finished);
+    }
 
-            Log()->Warning("[Net] Dropped packet: ParseHeaderDetailed failed. err={} bytes={} dropped={} typeRaw={} seqRaw={}",
-                           ParseErrorToString(parseErr), data.size(), badPacketsDropped_, typeRaw, seqRaw);
+    void GameClient::ReportBadDatagram(const DatagramCheck & check)
+    {
+        using namespace Utils::Legacy::Game::Net;
 
-            // CRC/size/version mismatch means packet is unusable -> request world repair
-            net_.pendingFullRequest = true;
-            net_.pendingFullRequestAllSegments = true;
-            return;
-        }
+        badPacketsDropped_++;
 
-        // safety: ensure payloadBytes fits buffer (already guaranteed by ParseHeaderDetailed size check)
-        const std::size_t totalNeed = sizeof(MessageHeader) + static_cast<std::size_t>(header.payloadBytes);
-        if (totalNeed > data.size())
+        if (check.parseError != ParseError::Ok)
+        {
+            Log()->Warning("[Net] Dropped packet: ParseHeaderDetailed failed. err={} bytes={} dropped={} typeRaw={} seqRaw={}",
+                           ParseErrorToString(check.parseError), check.bytes, badPacketsDropped_, check.typeRaw, check.seqRaw);
+        }
+        else
         {
-            badPacketsDropped_++;
             Log()->Warning("[Net] Dropped packet: payloadBytes out of bounds. bytes={} payloadBytes={} need={} dropped={} type={} seq={}",
-                           data.size(), header.payloadBytes, totalNeed, badPacketsDropped_, header.type, header.seq);
-            net_.pendingFullRequest = true;
-            net_.pendingFullRequestAllSegments = true;
-            return;
+                           check.bytes, check.header.payloadBytes, sizeof(MessageHeader) + check.header.payloadBytes,
+                           badPacketsDropped_, check.header.type, check.header.seq);
         }
 
+        // CRC/size/version mismatch means packet is unusable -> request world repair
+        net_.pendingFullRequest = true;
+        net_.pendingFullRequestAllSegments = true;
+    }
+
+    void GameClient::HandleMessage(const Utils::Legacy::Game::Net::MessageHeader & header,
+                                   const std::span<const std::uint8_t> payload,
+                                   const std::size_t bytes)
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        bytesReceived_ += bytes;
+        datagramsReceived_++;
+
         const auto type = static_cast<MessageType>(header.type);
 
+        messageAck_ = header.ack;
+
         // stats
         if (type == MessageType::FullUpdate)
         {
-            lastFullPacketBytes_ = static_cast<std::uint32_t>(data.size());
+            lastFullPacketBytes_ = static_cast<std::uint32_t>(bytes);
             lastFullPayloadBytes_ = header.payloadBytes;
         }
         else if (type == MessageType::PartialUpdate)
         {
-            lastPartialPacketBytes_ = static_cast<std::uint32_t>(data.size());
+            lastPartialPacketBytes_ = static_cast<std::uint32_t>(bytes);
             lastPartialPayloadBytes_ = header.payloadBytes;
         }
 
-        // sequence check ONLY for Full/Partial updates (snapshot is out-of-band)
+        // update stream (snapshot is out-of-band)
         if (type == MessageType::FullUpdate || type == MessageType::PartialUpdate)
         {
-            if (net_.hasSeq)
+            ReceiveUpdate(header, payload);
+            return;
+        }
+
+        ByteReader reader(payload);
+
+        if (Net::IsExt(header.type, Net::ExtMessageType::ServerFeatures))
+        {
+            ApplyServerFeatures(reader);
+            return;
+        }
+
+        if (Net::IsExt(header.type, Net::ExtMessageType::FullUpdateChunk))
+        {
+            lastFullPacketBytes_ = static_cast<std::uint32_t>(bytes);
+            lastFullPayloadBytes_ = header.payloadBytes;
+
+            ApplyFullUpdateChunk(reader);
+            return;
+        }
+
+        if (type == MessageType::SnakeSnapshot)
+        {
+            ApplySnakeSnapshot(reader);
+            return;
+        }
+    }
+
+    void GameClient::ReceiveUpdate(const Utils::Legacy::Game::Net::MessageHeader& header,
+                                   const std::span<const std::uint8_t> payload)
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        // a full update is a new baseline, holes before it do not matter
+        const bool full = static_cast<MessageType>(header.type) == MessageType::FullUpdate;
+
+        if (full && net_.hasSeq && header.seq <= net_.lastServerSeq)
+        {
+            // within the ack window it is a duplicate or was overtaken by newer partials;
+            // further back it can not be a straggler: the server restarted its seq space
+            if (net_.lastServerSeq - header.seq <= UpdateWindow::AckBits)
+            {
+                updatesLate_++;
+                return;
+            }
+
+            Log()->Warning("[Net] Full update seq={} far behind seq={} -> update stream rebased",
+                           header.seq, net_.lastServerSeq);
+            RebaseUpdateStream();
+        }
+
+        if (!updateWindow_.MarkReceived(header.seq) || (net_.hasSeq && header.seq <= net_.lastServerSeq))
+        {
+            // duplicate, or arrived after its slot was given up on: newer state is applied already
+            updatesLate_++;
+            return;
+        }
+
+        if (!net_.hasSeq || full || header.seq == net_.lastServerSeq + 1)
+        {
+            ApplyUpdateInOrder(header, payload);
+            DrainReorderWindow(0);
+            return;
+        }
+
+        // past a hole: wait for it, unless the hole is wider than the window
+        if (header.seq - net_.lastServerSeq - 1 > UpdateWindow::ReorderSlots ||
+            !updateWindow_.Stash(header, payload, messageTime_))
+        {
+            DrainReorderWindow(header.seq);
+            ApplyUpdateInOrder(header, payload);
+            DrainReorderWindow(0);
+        }
+    }
+
+    void GameClient::ApplyUpdateInOrder(const Utils::Legacy::Game::Net::MessageHeader& header,
+                                        const std::span<const std::uint8_t> payload)
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        const auto type = static_cast<MessageType>(header.type);
+
+        if (net_.hasSeq && header.seq > net_.lastServerSeq)
+        {
+            const std::uint32_t lost = header.seq - net_.lastServerSeq - 1;
+            snapshotPacer_.OnUpdateReceived(lost);
+
+            if (lost > 0 && type == MessageType::PartialUpdate)
             {
-                if (header.seq != net_.lastServerSeq + 1)
+                updatesLost_ += lost;
+
+                if (net_.serverFeatures & Net::ServerFeature_AckedUpdates)
+                {
+                    // the server repeats what we did not ack, nothing to repair
+                    Log()->Debug("[Net] Update seq hole: lost={} before seq={} total={}", lost, header.seq, updatesLost_);
+                }
+                else
                 {
+                    // events of the lost update (spawns, removals) are not sent again
                     Log()->Warning("[Net] Server seq mismatch: got={} expected={} -> request full update",
                                    header.seq, net_.lastServerSeq + 1);
 
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
-                    net_.lastServerSeq = header.seq;
                 }
-                else
-                {
-                    net_.lastServerSeq = header.seq;
-                }
-            }
-            else
-            {
-                net_.hasSeq = true;
-                net_.lastServerSeq = header.seq;
             }
         }
 
-        const auto payloadSpan = std::span<const std::uint8_t>(
-            data.data() + sizeof(MessageHeader),
-            header.payloadBytes
-        );
+        net_.hasSeq = true;
+        net_.lastServerSeq = header.seq;
 
-        ByteReader reader(payloadSpan);
+        ByteReader reader(payload);
 
         if (type == MessageType::FullUpdate)
         {
             ApplyFullUpdate(reader);
-            return;
         }
-
-        if (type == MessageType::PartialUpdate)
+        else
         {
             ApplyPartialUpdate(reader);
-            return;
         }
+    }
 
-        if (type == MessageType::SnakeSnapshot)
+    void GameClient::DrainReorderWindow(const std::uint32_t skipThrough)
+    {
+        while (auto slot = updateWindow_.Oldest())
+        {
+            const auto seq = slot->header.seq;
+            if (seq > net_.lastServerSeq + 1 && seq > skipThrough)
+                break;
+
+            if (seq > net_.lastServerSeq)
+            {
+                updatesReordered_++;
+
+                // applied with its own receive time / ack, then back to the current message
+                const auto time = std::exchange(messageTime_, slot->receivedAt);
+                const std::uint32_t slotAck = slot->header.ack;
+                const auto ack = std::exchange(messageAck_, slotAck);
+
+                ApplyUpdateInOrder(slot->header, slot->payload);
+
+                messageTime_ = time;
+                messageAck_ = ack;
+            }
+
+            UpdateWindow::Release(*slot);
+        }
+    }
+
+    void GameClient::SendUpdateAck()
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        if (!updateWindow_.Any() ||
+            (updateWindow_.Latest() == ackSentLatest_ && updateWindow_.Mask() == ackSentMask_))
         {
-            ApplySnakeSnapshot(reader);
             return;
         }
+
+        ackSentLatest_ = updateWindow_.Latest();
+        ackSentMask_ = updateWindow_.Mask();
+
+        Net::UpdateAckPayload ack{};
+        ack.latestSeq = ackSentLatest_;
+        ack.receivedMask = ackSentMask_;
+
+        outgoing_.Begin(Net::ToMessageType(Net::ExtMessageType::UpdateAck));
+        outgoing_.WritePod(ack);
     }
 
     bool GameClient::IsLoaded() const
@@ -365,6 +605,11 @@ namespace Core::App::Game
         connectCallback_ = std::move(callback);
     }
 
+    void GameClient::SetInterpolationDelay(const std::chrono::milliseconds delay)
+    {
+        interpolationDelay_ = std::max(delay, std::chrono::milliseconds::zero());
+    }
+
     Snake::Shared GameClient::GetPlayerSnake()
     {
         return clientSnake_;
@@ -381,66 +626,132 @@ namespace Core::App::Game
         return visibleRadius * (1.0f + visibilityPaddingPercent_);
     }
 
-    std::unordered_set<Snake::Shared> GameClient::GetNearestVictims()
+    template <class Visitor>
+    void GameClient::VisitFoodsInRadius(const sf::Vector2f& center, const float radius, Visitor&& visitor)
     {
-        std::unordered_set<Snake::Shared> nearestSnakes;
+        const sf::Vector2f extent(radius, radius);
+        const float radiusSq = radius * radius;
 
-        if (!clientSnake_)
+        foodGrid_.ForEachInRange(foodGrid_.RangeOf(center - extent, center + extent), [&](const std::uint32_t id)
         {
-            return nearestSnakes;
-        }
+            const auto rec = foodRecords_.Find(id);
+            if (!rec || !rec->food)
+                return;
 
-        const sf::Vector2f playerPos = clientSnake_->GetPosition();
-        const float radius = GetVisibleRadiusWithPadding();
-        const float radiusSq = radius * radius;
+            const auto pos = rec->food->GetPosition();
+            const float dx = pos.x - center.x;
+            const float dy = pos.y - center.y;
+
+            if ((dx * dx + dy * dy) <= radiusSq)
+            {
+                visitor(*rec);
+            }
+        });
+    }
 
-        nearestSnakes.reserve(snakes_.size());
+    template <class Visitor>
+    void GameClient::VisitSnakesInRect(const sf::Vector2f& min, const sf::Vector2f& max, Visitor&& visitor)
+    {
+        // a snake body spans several cells: stamp records so each one is reported once
+        const auto stamp = ++queryStamp_;
 
-        for (const auto& s : snakes_)
+        snakeGrid_.ForEachInRange(snakeGrid_.RangeOf(min, max), [&](const std::uint32_t id)
         {
-            if (!s)
-                continue;
+            const auto rec = snakeRecords_.Find(id);
+            if (!rec || !rec->snake || rec->queryStamp == stamp)
+                return;
 
-            if (s->EntityID() == playerEntityID_)
-                continue;
+            rec->queryStamp = stamp;
 
-            nearestSnakes.insert(std::static_pointer_cast<Snake>(s));
-        }
+            if (rec->boundsMax.x < min.x || rec->boundsMin.x > max.x ||
+                rec->boundsMax.y < min.y || rec->boundsMin.y > max.y)
+                return;
 
-        return nearestSnakes;
+            visitor(*rec);
+        });
     }
 
-    std::unordered_set<Food::Shared> GameClient::GetNearestFoods()
+    std::unordered_set<Snake::Shared> GameClient::GetNearestVictims()
     {
-        std::unordered_set<Food::Shared> nearestFoods;
+        std::unordered_set<Snake::Shared> nearestSnakes;
 
         if (!clientSnake_)
         {
-            return nearestFoods;
+            return nearestSnakes;
         }
 
         const sf::Vector2f playerPos = clientSnake_->GetPosition();
         const float radius = GetVisibleRadiusWithPadding();
-        const float radiusSq = radius * radius;
+        const sf::Vector2f extent(radius, radius);
+
+        VisitSnakesInRect(playerPos - extent, playerPos + extent, [&](const SnakeRecord& rec)
+        {
+            if (rec.snake->EntityID() == playerEntityID_)
+                return;
+
+            nearestSnakes.insert(std::static_pointer_cast<Snake>(rec.snake));
+        });
 
-        nearestFoods.reserve(foods_.size());
+        return nearestSnakes;
+    }
 
-        for (const auto& f : foods_)
+    std::unordered_set<Food::Shared> GameClient::GetNearestFoods()
+    {
+        std::unordered_set<Food::Shared> nearestFoods;
+
+        if (!clientSnake_)
         {
-            if (!f)
-                continue;
+            return nearestFoods;
+        }
 
-            const auto pos = f->GetPosition();
-            const float dx = pos.x - playerPos.x;
-            const float dy = pos.y - playerPos.y;
+        VisitFoodsInRadius(clientSnake_->GetPosition(), GetVisibleRadiusWithPadding(), [&](const FoodRecord& rec)
+        {
+            nearestFoods.insert(std::static_pointer_cast<Food>(rec.food));
+        });
 
-            if ((dx * dx + dy * dy) <= radiusSq)
+        return nearestFoods;
+    }
+
+    void GameClient::ForEachFoodInRadius(const sf::Vector2f& center,
+                                         const float radius,
+                                         const FunctionRef<void(const Food&)> visitor)
+    {
+        VisitFoodsInRadius(center, radius, [&](const FoodRecord& rec)
+        {
+            visitor(*rec.food);
+        });
+    }
+
+    void GameClient::ForEachSnakeInRect(const sf::FloatRect& rect,
+                                        const FunctionRef<void(const Snake&, const SegmentRing&)> visitor)
+    {
+        const sf::Vector2f min(rect.left, rect.top);
+        const sf::Vector2f max(rect.left + rect.width, rect.top + rect.height);
+
+        const bool interpolate = interpolationDelay_ > SnapshotBuffer::Clock::duration::zero();
+        const auto renderTime = SnapshotBuffer::Clock::now() - interpolationDelay_;
+
+        VisitSnakesInRect(min, max, [&](SnakeRecord& rec)
+        {
+            // the player is predicted locally and always drawn as is
+            if (!interpolate || rec.snake == clientSnake_ || rec.snapshots.Empty())
             {
-                nearestFoods.insert(std::static_pointer_cast<Food>(f));
+                visitor(*rec.snake, rec.body);
+                return;
             }
-        }
 
-        return nearestFoods;
+            BuildRenderBody(rec.body, rec.snapshots.Sample(renderTime, MaxExtrapolation), rec.renderBody);
+            visitor(*rec.snake, rec.renderBody);
+        });
+    }
+
+    const SegmentRing* GameClient::GetSnakeBody(const std::uint32_t entityID) const
+    {
+        const auto rec = snakeRecords_.Find(entityID);
+        if (!rec || !rec->snake)
+            return nullptr;
+
+        return &rec->body;
     }
 
     void GameClient::ForceFullUpdateRequest()
@@ -455,8 +766,8 @@ namespace Core::App::Game
     DebugInfo GameClient::GetDebugInfo() const
     {
         DebugInfo info{};
-        info.foodsCount = static_cast<std::uint32_t>(foodsByID_.size());
-        info.snakesCount = static_cast<std::uint32_t>(snakesByID_.size());
+        info.foodsCount = static_cast<std::uint32_t>(foods_.size());
+        info.snakesCount = static_cast<std::uint32_t>(snakes_.size());
 
         info.lastFullPacketBytes = lastFullPacketBytes_;
         info.lastPartialPacketBytes = lastPartialPacketBytes_;
@@ -474,6 +785,34 @@ namespace Core::App::Game
 
         info.badPacketsDropped = badPacketsDropped_;
 
+        info.snapshotRttMs = snapshotPacer_.SrttMs();
+        info.lossPercent = snapshotPacer_.Loss() * 100.f;
+        info.snapshotWindow = snapshotPacer_.Window();
+        info.snapshotsInFlight = snapshotsInFlight_;
+        info.snapshotsPending = static_cast<std::uint32_t>(pendingSnakeSnapshots_.size());
+
+        info.updatesLost = updatesLost_;
+        info.updatesReordered = updatesReordered_;
+        info.updatesLate = updatesLate_;
+
+        info.predictionError = prediction_.lastError;
+        info.inputsUnacked = static_cast<std::uint32_t>(prediction_.inputs.Size());
+
+        info.interpolationDelayMs = std::chrono::duration<float, std::milli>(interpolationDelay_).count();
+
+        info.bytesReceived = bytesReceived_;
+        info.datagramsReceived = datagramsReceived_;
+        info.decodeMicros = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(decodeTime_).count());
+        info.fullRequestsSent = fullRequestsSent_;
+        info.droppedTicks = fixedStep_.DroppedTicks();
+        info.tickLateMs = tickLateMs_;
+
+        if (netWorker_)
+        {
+            info.netInboundDrops = netWorker_->InboundDrops();
+            info.netOutboundDrops = netWorker_->OutboundDrops();
+        }
+
         return info;
     }
 
@@ -482,12 +821,25 @@ namespace Core::App::Game
         return frame_;
     }
 
+    float GameClient::GetTickAlpha() const
+    {
+        return fixedStep_.Alpha();
+    }
+
 
-    GameClient::Shared GameClient::Create(const BaseServiceContainer * parent, const std::uint8_t serverID)
+    GameClient::Shared GameClient::Create(const BaseServiceContainer * parent, const std::uint8_t serverID,
+                                          const std::uint32_t ioThreads)
+    {
+        const auto obj = std::make_shared<GameClient>();
+        obj->SetupContainer(parent);
+        obj->Initialise(serverID, ioThreads);
+        return obj;
+    }
+
+    GameClient::Shared GameClient::CreateOffline(const BaseServiceContainer * parent)
     {
         const auto obj = std::make_shared<GameClient>();
         obj->SetupContainer(parent);
-        obj->Initialise(serverID);
         return obj;
     }
 
@@ -495,21 +847,84 @@ namespace Core::App::Game
 
     void GameClient::ClearWorld()
     {
-        snakesByID_.clear();
-        foodsByID_.clear();
-        predict_.clear();
+        snakeRecords_.Clear();
+        foodRecords_.Clear();
+
+        snakeGrid_.Clear();
+        foodGrid_.Clear();
 
         snakes_.clear();
         foods_.clear();
 
-        snakesTTL_.clear();
-        foodsTTL_.clear();
-
-        snakeSnapshotCooldownFrame_.clear();
         pendingSnakeSnapshots_.clear();
+        snapshotsInFlight_ = 0;
+
+        // a new connection (or a restarted server) starts its own seq space
+        net_.hasSeq = false;
+        net_.lastServerSeq = 0;
+
+        chunks_ = {};
+
+        updateWindow_.Clear();
+        ackSentLatest_ = 0;
+        ackSentMask_ = 0;
 
         clientSnake_.reset();
         playerEntityID_ = 0;
+
+        ResetPrediction();
+    }
+
+    void GameClient::RebaseUpdateStream()
+    {
+        net_.hasSeq = false;
+        net_.lastServerSeq = 0;
+
+        chunks_ = {};
+
+        updateWindow_.Clear();
+        ackSentLatest_ = 0;
+        ackSentMask_ = 0;
+
+        // seqs of the old stream mean nothing in the new one: the full update that rebases
+        // decides what stays, the TTL sweep counts from it
+        for (auto& rec : snakeRecords_.Records())
+            rec.lastSeenSeq = 0;
+
+        for (auto& rec : foodRecords_.Records())
+            rec.lastSeenSeq = 0;
+    }
+
+    void GameClient::RemoveAbsentEntities(const std::uint32_t epoch, const std::uint32_t updateSeq)
+    {
+        foodRecords_.EraseIf([&](const std::uint32_t id, FoodRecord& rec)
+        {
+            if (rec.fullEpoch == epoch || rec.lastSeenSeq > updateSeq)
+                return false;
+
+            if (rec.food)
+                foods_.erase(rec.food);
+
+            foodGrid_.Remove(id, rec.cells);
+            return true;
+        });
+
+        snakeRecords_.EraseIf([&](const std::uint32_t id, SnakeRecord& rec)
+        {
+            // snapshot-only records have nothing to reconcile; spawned by a newer update than
+            // the full one (while its chunks were in flight): not absent
+            if (!rec.snake || rec.fullEpoch == epoch || rec.lastSeenSeq > updateSeq)
+                return false;
+
+            snakes_.erase(rec.snake);
+            snakeGrid_.Remove(id, rec.cells);
+            pendingSnakeSnapshots_.erase(id);
+
+            if (rec.snake == clientSnake_)
+                clientSnake_.reset();
+
+            return true;
+        });
     }
 
     void GameClient::RemoveEntity(const Utils::Legacy::Game::Net::EntityType type,
@@ -519,178 +934,548 @@ namespace Core::App::Game
 
         if (type == EntityType::Snake)
         {
-            if (snakesByID_.contains(entityID))
+            if (chunks_.active)
+                fullApply_.removedSnakes[entityID] = net_.lastServerSeq;
+
+            const auto rec = snakeRecords_.Find(entityID);
+            if (!rec)
+                return;
+
+            if (rec->snake)
+                snakes_.erase(rec->snake);
+
+            snakeGrid_.Remove(entityID, rec->cells);
+            snakeRecords_.Erase(entityID);
+
+            if (entityID == playerEntityID_)
+            {
+                if (clientSnake_)
+                    clientSnake_->Kill(frame_);
+            }
+        }
+        else if (type == EntityType::Food)
+        {
+            if (chunks_.active)
+                fullApply_.removedFoods[entityID] = net_.lastServerSeq;
+
+            const auto rec = foodRecords_.Find(entityID);
+            if (!rec)
+                return;
+
+            if (rec->food)
+                foods_.erase(rec->food);
+
+            foodGrid_.Remove(entityID, rec->cells);
+            foodRecords_.Erase(entityID);
+        }
+    }
+
+    void GameClient::UpsertFood(const std::uint32_t entityID,
+                               const Utils::Legacy::Game::Net::FoodState& fs,
+                               const bool /*isNew*/)
+    {
+        auto& rec = foodRecords_.GetOrCreate(entityID);
+
+        const sf::Vector2f pos(fs.x, fs.y);
+
+        // food does not move: a re-sent (or re-flagged New) food at the same spot is refreshed
+        // in place, so the pointer the renderer holds stays the same and nothing is allocated
+        if (!rec.food || rec.food->GetPosition() != pos)
+        {
+            if (rec.food)
+                foods_.erase(rec.food);
+
+            rec.food = foodPool_.Make(0, pos);
+            rec.food->SetEntityID(entityID);
+
+            foods_.insert(rec.food);
+
+            const auto cells = foodGrid_.RangeOf(pos);
+            foodGrid_.Move(entityID, rec.cells, cells);
+            rec.cells = cells;
+        }
+
+        rec.lastSeenSeq = net_.lastServerSeq;
+    }
+
+    void GameClient::UpsertSnakeFull(const std::uint32_t entityID,
+                                    const Utils::Legacy::Game::Net::SnakeState& ss,
+                                    const std::vector<sf::Vector2f>& fullSegments,
+                                    const bool isNew)
+    {
+        // sanity
+        constexpr std::uint32_t maxReasonableExp = 5'000'000;
+        constexpr std::uint32_t maxReasonableSegments = 60'000;
+
+        if (ss.experience > maxReasonableExp || ss.totalSegments == 0 || ss.totalSegments > maxReasonableSegments)
+        {
+            badPacketsDropped_++;
+            Log()->Warning("[Net] Dropped snake FULL: insane exp/segments. entityID={} exp={} totalSegments={} dropped={} seq={}",
+                           entityID, ss.experience, ss.totalSegments, badPacketsDropped_, net_.lastServerSeq);
+            net_.pendingFullRequest = true;
+            net_.pendingFullRequestAllSegments = true;
+            return;
+        }
+
+        if (fullSegments.size() != static_cast<std::size_t>(ss.totalSegments))
+        {
+            badPacketsDropped_++;
+            Log()->Warning("[Net] Dropped snake FULL: pointsCount != totalSegments. entityID={} pointsCount={} totalSegments={} dropped={} seq={}",
+                           entityID, fullSegments.size(), ss.totalSegments, badPacketsDropped_, net_.lastServerSeq);
+            net_.pendingFullRequest = true;
+            net_.pendingFullRequestAllSegments = true;
+            return;
+        }
+
+        auto& rec = snakeRecords_.GetOrCreate(entityID);
+
+        const bool created = isNew || !rec.snake;
+
+        if (created)
+        {
+            if (rec.snake)
+                snakes_.erase(rec.snake);
+
+            rec.snake = snakePool_.Make(0, sf::Vector2f(ss.headX, ss.headY));
+            rec.snake->SetEntityID(entityID);
+
+            snakes_.insert(rec.snake);
+
+            rec.snapshots.Reset();
+        }
+
+        // also covers a survivor that became the player after a full update
+        if (entityID == playerEntityID_)
+        {
+            clientSnake_ = rec.snake;
+        }
+
+        const auto& snake = rec.snake;
+
+        const bool isPlayer = snake == clientSnake_;
+
+        // the predicted player keeps its local body unless it is being rebuilt
+        if (isPlayer && !created && !awaitingPlayerRebuild_ && ReconcilePlayer({ ss.headX, ss.headY }))
+        {
+            snake->NetApplyExperience(ss.experience);
+            rec.lastSeenSeq = net_.lastServerSeq;
+            UpdateSnakeBounds(entityID, rec, fullSegments);
+            return;
+        }
+
+        const sf::Vector2f headBefore = snake->GetPosition();
+
+        snake->NetApplyExperience(ss.experience);
+        snake->NetSetFullSegments(fullSegments);
+        SyncBody(rec);
+
+        if (isPlayer && !created)
+        {
+            // the jump to the server body counts as a correction, so inputs sent before it
+            // still reconcile against the right head
+            prediction_.applied += snake->GetPosition() - headBefore;
+            prediction_.pending = {};
+        }
+
+        rec.snapshots.Push(messageTime_, { ss.headX, ss.headY });
+
+        rec.lastSeenSeq = net_.lastServerSeq;
+
+        UpdateSnakeBounds(entityID, rec, fullSegments);
+
+        if (entityID == playerEntityID_ && awaitingPlayerRebuild_)
+        {
+            awaitingPlayerRebuild_ = false;
+            Log()->Warning("[Net] Player rebuilt from FULL segments OK. playerID={} segs={}",
+                           playerEntityID_, snake->Segments().size());
+        }
+    }
+
+    void GameClient::QueueSnakeSnapshotRequest(const std::uint32_t entityID)
+    {
+        // never request snapshot for player: player repair uses FullUpdate(allSegments)
+        if (entityID == playerEntityID_)
+        {
+            ForceFullUpdateRequest();
+            return;
+        }
+
+        // cooldown to avoid spam
+        const std::uint32_t nowFrame = frame_;
+        auto& rec = snakeRecords_.GetOrCreate(entityID);
+        if (rec.snapshotInFlight || nowFrame < rec.snapshotCooldownFrame)
+        {
+            return;
+        }
+
+        // one RTO between requests for the same snake: fast on a good link, no spam on a bad one
+        rec.snapshotCooldownFrame = nowFrame + snapshotPacer_.RetryFrames();
+        pendingSnakeSnapshots_.insert(entityID);
+
+        Log()->Warning("[Net] QueueSnakeSnapshotRequest(entityID={})", entityID);
+    }
+
+    void GameClient::SendSnakeSnapshotRequests()
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        const bool batch = (net_.serverFeatures & Net::ServerFeature_SnapshotBatch) != 0;
+
+        // without batch support every request is its own datagram: keep the old per-tick cap
+        std::uint32_t budget = snapshotPacer_.Budget(snapshotsInFlight_);
+        budget = std::min<std::uint32_t>(budget, batch ? Net::MaxSnapshotBatch : 16);
+
+        const auto now = now_;
+
+        auto& ids = snapshotBatchScratch_;
+        ids.clear();
+
+        for (auto it = pendingSnakeSnapshots_.begin(); it != pendingSnakeSnapshots_.end() && ids.size() < budget; )
+        {
+            const auto entityID = *it;
+            it = pendingSnakeSnapshots_.erase(it);
+
+            // record may have been swept while queued
+            const auto rec = snakeRecords_.Find(entityID);
+            if (!rec)
+                continue;
+
+            rec->snapshotInFlight = true;
+            rec->snapshotRequestedAt = now;
+            ids.push_back(entityID);
+        }
+
+        if (ids.empty())
+        {
+            return;
+        }
+
+        snapshotsInFlight_ += static_cast<std::uint32_t>(ids.size());
+
+        if (batch)
+        {
+            Net::RequestSnakeSnapshotsPayload rq{};
+            rq.count = static_cast<std::uint16_t>(ids.size());
+
+            outgoing_.Begin(Net::ToMessageType(Net::ExtMessageType::RequestSnakeSnapshots));
+            outgoing_.WritePod(rq);
+
+            for (const auto entityID : ids)
             {
-                const auto ptr = snakesByID_[entityID];
-                snakesByID_.erase(entityID);
+                outgoing_.WritePod(entityID);
+            }
+            return;
+        }
+
+        for (const auto entityID : ids)
+        {
+            RequestSnakeSnapshotPayload rq{};
+            rq.entityID = entityID;
+
+            outgoing_.Begin(MessageType::RequestSnakeSnapshot);
+            outgoing_.WritePod(rq);
+        }
+    }
+
+    void GameClient::ExpireSnakeSnapshotRequests()
+    {
+        if (snapshotsInFlight_ == 0)
+        {
+            return;
+        }
+
+        const auto deadline = now_ - snapshotPacer_.Rto();
+
+        std::uint32_t inFlight = 0;
+        std::uint32_t timedOut = 0;
+        for (auto& rec : snakeRecords_.Records())
+        {
+            if (!rec.snapshotInFlight)
+                continue;
+
+            if (rec.snapshotRequestedAt < deadline)
+            {
+                // lost request or lost answer; drift validation queues it again if still needed
+                rec.snapshotInFlight = false;
+                rec.snapshotResent = true;
+                timedOut++;
+                continue;
+            }
+
+            inFlight++;
+        }
+
+        if (timedOut > 0)
+        {
+            snapshotPacer_.OnSnapshotTimedOut(now_);
+        }
+
+        // also drops requests whose records were swept
+        snapshotsInFlight_ = inFlight;
+    }
+
+    void GameClient::ApplyServerFeatures(Utils::Legacy::Game::Net::ByteReader& reader)
+    {
+        Net::ServerFeaturesPayload features{};
+        if (!reader.ReadPod(features))
+        {
+            Log()->Warning("[Net] Dropped ServerFeatures: short payload");
+            return;
+        }
+
+        net_.serverFeatures = features.features;
+        Log()->Debug("[Net] Server features: {:#x}", net_.serverFeatures);
+
+        // tell the server which optional encodings it may use for us (goes out with the next input)
+        Net::ClientFeaturesPayload client{};
+        client.features = Net::ClientFeature_DeltaPoints | Net::ClientFeature_ChunkedFullUpdate | Net::ClientFeature_UpdateAcks;
+
+        outgoing_.Begin(Net::ToMessageType(Net::ExtMessageType::ClientFeatures));
+        outgoing_.WritePod(client);
+    }
+
+    void GameClient::SyncBody(SnakeRecord& rec)
+    {
+        const auto& segments = rec.snake->Segments();
+        rec.body.Reserve(segments.size());
+        rec.body.Assign(segments.begin(), segments.end());
+    }
+
+    void GameClient::SyncBodyStep(SnakeRecord& rec)
+    {
+        const auto& segments = rec.snake->Segments();
+
+        // a step puts a few new points in front of the old body (the old head may have moved
+        // in place too), so the old second point is near the list front
+        constexpr std::size_t maxStep = 4;
+
+        if (rec.body.size() < 2 || segments.size() < 2)
+        {
+            SyncBody(rec);
+            return;
+        }
+
+        const sf::Vector2f anchor = rec.body[1];
+
+        auto it = segments.begin();
+        std::size_t index = 0;
+        while (it != segments.end() && index <= maxStep + 1 && *it != anchor)
+        {
+            ++it;
+            ++index;
+        }
+
+        if (it == segments.end() || index > maxStep + 1)
+        {
+            SyncBody(rec);
+            return;
+        }
+
+        // the points before the anchor replace the old head
+        rec.body.PopFront();
+        for (auto p = std::make_reverse_iterator(it); p != segments.rend(); ++p)
+        {
+            rec.body.PushFront(*p);
+        }
+
+        // tail: popped by the step, or grown / shrunk by experience
+        while (rec.body.size() > segments.size())
+        {
+            rec.body.PopBack();
+        }
+
+        if (const auto missing = segments.size() - rec.body.size(); missing > 0)
+        {
+            for (auto p = std::prev(segments.end(), static_cast<std::ptrdiff_t>(missing)); p != segments.end(); ++p)
+            {
+                rec.body.PushBack(*p);
+            }
+        }
+
+        // anything else (the whole body or points inside it moved) takes the full copy: check
+        // both ends and a point next to each, the rest is trusted
+        const auto next = std::next(it);
+        const bool same = rec.body.size() == segments.size() &&
+                          rec.body.front() == segments.front() &&
+                          rec.body.back() == segments.back() &&
+                          (next == segments.end() || rec.body[index + 1] == *next) &&
+                          rec.body[rec.body.size() - 2] == *std::prev(segments.end(), 2);
+
+        if (!same)
+        {
+            SyncBody(rec);
+        }
+    }
+
+    bool GameClient::ReconcilePlayer(const sf::Vector2f& serverHead)
+    {
+        auto& p = prediction_;
 
-                if (ptr)
-                    snakes_.erase(ptr);
+        // only an update that acks a new input can be matched to a prediction; for the rest
+        // the local state is newer than the server's
+        PredictionRing::Entry acked;
+        const bool fresh = messageAck_ > p.lastAck && p.inputs.Ack(messageAck_, acked);
+        p.lastAck = std::max(p.lastAck, messageAck_);
 
-                predict_.erase(entityID);
-                snakesTTL_.erase(entityID);
-                snakeSnapshotCooldownFrame_.erase(entityID);
+        if (!fresh)
+            return p.active;
 
-                if (entityID == playerEntityID_)
-                {
-                    if (clientSnake_)
-                        clientSnake_->Kill(frame_);
-                }
-            }
-        }
-        else if (type == EntityType::Food)
-        {
-            if (foodsByID_.contains(entityID))
-            {
-                const auto ptr = foodsByID_[entityID];
-                foodsByID_.erase(entityID);
+        p.active = true;
 
-                if (ptr)
-                    foods_.erase(ptr);
+        // replaying the unacked inputs on top of the server state moves the head as far as the
+        // local simulation moved it since `acked`, so the error left is the one at `acked`
+        // minus what was corrected since then
+        const sf::Vector2f error = serverHead - acked.head - (p.applied - acked.correction);
 
-                foodsTTL_.erase(entityID);
-            }
-        }
+        p.pending = error;
+        p.lastError = std::sqrt(error.x * error.x + error.y * error.y);
+        return true;
     }
 
-    void GameClient::UpsertFood(const std::uint32_t entityID,
-                               const Utils::Legacy::Game::Net::FoodState& fs,
-                               const bool isNew)
+    void GameClient::ApplyPredictionCorrection()
     {
-        if (isNew || !foodsByID_.contains(entityID))
-        {
-            auto f = std::make_shared<EntityFood>(0, sf::Vector2f(fs.x, fs.y));
-            f->SetEntityID(entityID);
+        auto& p = prediction_;
+        if (!clientSnake_ || (p.pending.x == 0.f && p.pending.y == 0.f))
+            return;
 
-            foodsByID_[entityID] = f;
-            foods_.insert(f);
-        }
-        else
-        {
-            auto f = std::make_shared<EntityFood>(0, sf::Vector2f(fs.x, fs.y));
-            f->SetEntityID(entityID);
+        const float length = std::sqrt(p.pending.x * p.pending.x + p.pending.y * p.pending.y);
 
-            const auto old = foodsByID_[entityID];
-            if (old)
-                foods_.erase(old);
+        sf::Vector2f delta = p.pending;
+        if (length < PredictionSnapDistance && length > 0.5f)
+            delta *= PredictionBlend;
 
-            foodsByID_[entityID] = f;
-            foods_.insert(f);
-        }
+        clientSnake_->NetSetHead(clientSnake_->GetPosition() + delta);
 
-        foodsTTL_[entityID].lastSeenSeq = net_.lastServerSeq;
+        p.pending -= delta;
+        p.applied += delta;
     }
 
-    void GameClient::UpsertSnakeFull(const std::uint32_t entityID,
-                                    const Utils::Legacy::Game::Net::SnakeState& ss,
-                                    const std::vector<sf::Vector2f>& fullSegments,
-                                    const bool isNew)
+    void GameClient::ResetPrediction()
     {
-        // sanity
-        constexpr std::uint32_t maxReasonableExp = 5'000'000;
-        constexpr std::uint32_t maxReasonableSegments = 60'000;
+        prediction_ = {};
+    }
 
-        if (ss.experience > maxReasonableExp || ss.totalSegments == 0 || ss.totalSegments > maxReasonableSegments)
-        {
-            badPacketsDropped_++;
-            Log()->Warning("[Net] Dropped snake FULL: insane exp/segments. entityID={} exp={} totalSegments={} dropped={} seq={}",
-                           entityID, ss.experience, ss.totalSegments, badPacketsDropped_, net_.lastServerSeq);
-            net_.pendingFullRequest = true;
-            net_.pendingFullRequestAllSegments = true;
+    void GameClient::BuildRenderBody(const SegmentRing& body, const SnapshotBuffer::Result& at, SegmentRing& out)
+    {
+        out.Clear();
+
+        const std::size_t count = body.size();
+        if (count == 0)
             return;
-        }
 
-        if (fullSegments.size() != static_cast<std::size_t>(ss.totalSegments))
+        out.Reserve(count);
+        out.PushBack(at.head);
+
+        // the body is the path the head took: point i sits at the same path distance from the
+        // rendered head as it does from the newest one. Ahead of the newest head the path is
+        // first extended to at.head, past the tail it continues straight.
+        const bool ahead = at.behind < 0.f;
+        const std::size_t pathSize = ahead ? count + 1 : count;
+        const float offset = ahead ? 0.f : at.behind;
+
+        auto Path = [&](const std::size_t k) -> sf::Vector2f
         {
-            badPacketsDropped_++;
-            Log()->Warning("[Net] Dropped snake FULL: pointsCount != totalSegments. entityID={} pointsCount={} totalSegments={} dropped={} seq={}",
-                           entityID, fullSegments.size(), ss.totalSegments, badPacketsDropped_, net_.lastServerSeq);
-            net_.pendingFullRequest = true;
-            net_.pendingFullRequestAllSegments = true;
+            if (ahead)
+                return k == 0 ? at.head : body[k - 1];
+            return body[k];
+        };
+
+        auto Len = [](const sf::Vector2f v) { return std::sqrt(v.x * v.x + v.y * v.y); };
+
+        if (pathSize < 2)
             return;
-        }
 
-        EntitySnake::Shared snake;
+        std::size_t seg = 0; // path segment seg -> seg + 1
+        float segStart = 0.f;
+        float segLen = Len(Path(1) - Path(0));
 
-        if (isNew || !snakesByID_.contains(entityID))
-        {
-            snake = std::make_shared<EntitySnake>(0, sf::Vector2f(ss.headX, ss.headY));
-            snake->SetEntityID(entityID);
+        float arc = 0.f;
+        sf::Vector2f prev = body[0];
 
-            snakesByID_[entityID] = snake;
-            snakes_.insert(snake);
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            const sf::Vector2f p = body[i];
+            arc += Len(p - prev);
+            prev = p;
 
-            if (entityID == playerEntityID_)
+            const float target = arc + offset;
+            while (seg + 2 < pathSize && segStart + segLen < target)
             {
-                clientSnake_ = snake;
+                segStart += segLen;
+                ++seg;
+                segLen = Len(Path(seg + 1) - Path(seg));
             }
-        }
-        else
-        {
-            snake = snakesByID_[entityID];
-        }
-
-        snake->NetApplyExperience(ss.experience);
-        snake->NetSetFullSegments(fullSegments);
 
-        snakesTTL_[entityID].lastSeenSeq = net_.lastServerSeq;
+            const sf::Vector2f a = Path(seg);
+            const sf::Vector2f b = Path(seg + 1);
+            const float t = segLen > 0.f ? (target - segStart) / segLen : 1.f;
 
-        if (entityID == playerEntityID_ && awaitingPlayerRebuild_)
-        {
-            awaitingPlayerRebuild_ = false;
-            Log()->Warning("[Net] Player rebuilt from FULL segments OK. playerID={} segs={}",
-                           playerEntityID_, snake->Segments().size());
+            out.PushBack(a + (b - a) * t);
         }
     }
 
-    void GameClient::QueueSnakeSnapshotRequest(const std::uint32_t entityID)
+    void GameClient::UpdateSnakeBounds(const std::uint32_t entityID,
+                                       SnakeRecord& rec,
+                                       const std::span<const sf::Vector2f> points)
     {
-        // never request snapshot for player: player repair uses FullUpdate(allSegments)
-        if (entityID == playerEntityID_)
-        {
-            ForceFullUpdateRequest();
-            return;
-        }
+        sf::Vector2f min = rec.snake->GetPosition();
+        sf::Vector2f max = min;
 
-        // cooldown to avoid spam
-        const std::uint32_t nowFrame = frame_;
-        const auto nextAllowed = snakeSnapshotCooldownFrame_.contains(entityID) ? snakeSnapshotCooldownFrame_[entityID] : 0u;
-        if (nowFrame < nextAllowed)
+        for (const auto& p : points)
         {
-            return;
+            min.x = std::min(min.x, p.x);
+            min.y = std::min(min.y, p.y);
+            max.x = std::max(max.x, p.x);
+            max.y = std::max(max.y, p.y);
         }
 
-        snakeSnapshotCooldownFrame_[entityID] = nowFrame + 64; // ~1s at 64 logic tick
-        pendingSnakeSnapshots_.insert(entityID);
+        // head radius + one sample spacing covers the body between validation samples
+        const float pad = rec.snake->GetRadius(true) + rec.snake->GetRadius(false);
+        rec.boundsMin = min - sf::Vector2f(pad, pad);
+        rec.boundsMax = max + sf::Vector2f(pad, pad);
 
-        Log()->Warning("[Net] QueueSnakeSnapshotRequest(entityID={})", entityID);
+        const auto cells = snakeGrid_.RangeOf(rec.boundsMin, rec.boundsMax);
+        snakeGrid_.Move(entityID, rec.cells, cells);
+        rec.cells = cells;
     }
 
     void GameClient::ApplySnakeValidationUpdate(const std::uint32_t entityID,
                                                const Utils::Legacy::Game::Net::SnakeState& ss,
-                                               const std::vector<sf::Vector2f>& samples,
+                                               const std::span<const sf::Vector2f> samples,
                                                const bool isNew)
     {
         // if we don't have baseline full segments for this snake -> request snapshot, do NOT build from samples
-        if (isNew || !snakesByID_.contains(entityID))
+        const auto rec = snakeRecords_.Find(entityID);
+        if (isNew || !rec || !rec->snake)
         {
             QueueSnakeSnapshotRequest(entityID);
             return;
         }
 
-        auto snake = snakesByID_[entityID];
-        if (!snake)
+        const auto snake = rec->snake;
+
+        // apply movement prediction step (the predicted player only takes a correction)
+        bool stepped = false;
+        if (snake != clientSnake_ || !ReconcilePlayer({ ss.headX, ss.headY }))
         {
-            QueueSnakeSnapshotRequest(entityID);
-            return;
+            snake->NetSetHead({ ss.headX, ss.headY });
+            snake->NetStepBody();
+            stepped = true;
         }
-
-        // apply movement prediction step
-        snake->NetSetHead({ ss.headX, ss.headY });
-        snake->NetStepBody();
         snake->NetApplyExperience(ss.experience);
 
-        snakesTTL_[entityID].lastSeenSeq = net_.lastServerSeq;
+        // only a pure body step is mirrored incrementally
+        if (stepped)
+            SyncBodyStep(*rec);
+        else
+            SyncBody(*rec);
+
+        rec->snapshots.Push(messageTime_, { ss.headX, ss.headY });
+
+        rec->lastSeenSeq = net_.lastServerSeq;
+
+        // samples run head -> tail along the whole body, good enough for the AABB
+        UpdateSnakeBounds(entityID, *rec, samples);
 
         // IMPORTANT: после ForceFullUpdate(allSegments) не валидируем player пока rebuild не завершён
         if (entityID == playerEntityID_ && awaitingPlayerRebuild_)
@@ -708,10 +1493,10 @@ namespace Core::App::Game
         const float base = std::max(120.0f, minDist * 3.0f);
         const float threshold = base;
 
-        if (!ValidateSamplesByRadius(snake->Segments(), samples, minDist, threshold))
+        if (!ValidateSamplesByRadius(rec->body, samples, minDist, threshold))
         {
             Log()->Warning("[Net] Snake drift validation failed -> request repair. entityID={} sampleCount={} segCount={}",
-                           entityID, samples.size(), snake->Segments().size());
+                           entityID, samples.size(), rec->body.size());
 
             QueueSnakeSnapshotRequest(entityID);
         }
@@ -721,8 +1506,6 @@ namespace Core::App::Game
     {
         using namespace Utils::Legacy::Game::Net;
 
-        ClearWorld();
-
         FullUpdateHeader fh{};
         if (!ReadFullUpdateHeader(reader, fh))
         {
@@ -734,10 +1517,51 @@ namespace Core::App::Game
             return;
         }
 
-        playerEntityID_ = fh.playerEntityID;
+        // a monolithic full update supersedes any chunked one still being assembled
+        chunks_.active = false;
+
+        BeginFullUpdate(fh.playerEntityID, net_.lastServerSeq);
+
+        const auto result = ApplyFullEntities(reader);
+        if (result == FullApplyResult::Failed)
+        {
+            return;
+        }
+
+        // a truncated packet does not say what is gone; leave the rest to the TTL sweep
+        FinishFullUpdate(result == FullApplyResult::Complete);
+    }
+
+    void GameClient::BeginFullUpdate(const std::uint32_t playerEntityID, const std::uint32_t updateSeq)
+    {
+        // reconciliation instead of a rebuild: every entity in the update is upserted in place
+        // and stamped with this epoch, whatever is left unstamped at the end is removed
+        fullApply_.epoch = ++fullUpdateEpoch_;
+        fullApply_.updateSeq = updateSeq;
+        fullApply_.playerBuiltExact = false;
+        fullApply_.removedSnakes.clear();
+        fullApply_.removedFoods.clear();
+
+        if (playerEntityID != playerEntityID_)
+        {
+            clientSnake_.reset();
+        }
+
+        playerEntityID_ = playerEntityID;
         awaitingPlayerRebuild_ = net_.pendingFullRequestAllSegments ? true : awaitingPlayerRebuild_;
+    }
+
+    bool GameClient::IsRemovedSince(const std::unordered_map<std::uint32_t, std::uint32_t>& removed,
+                                    const std::uint32_t entityID,
+                                    const std::uint32_t updateSeq)
+    {
+        const auto it = removed.find(entityID);
+        return it != removed.end() && it->second > updateSeq;
+    }
 
-        bool playerBuiltExact = false;
+    GameClient::FullApplyResult GameClient::ApplyFullEntities(Utils::Legacy::Game::Net::ByteReader& reader)
+    {
+        using namespace Utils::Legacy::Game::Net;
 
         while (!reader.End())
         {
@@ -745,7 +1569,7 @@ namespace Core::App::Game
             if (!reader.ReadPod(entry))
             {
                 Log()->Warning("[Net] Full update ended early: failed to read EntityEntryHeader");
-                break;
+                return FullApplyResult::Truncated;
             }
 
             if (entry.type == EntityType::Snake)
@@ -758,18 +1582,18 @@ namespace Core::App::Game
                                    entry.entityID, badPacketsDropped_, net_.lastServerSeq);
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
-                    return;
+                    return FullApplyResult::Failed;
                 }
 
                 // FullUpdate must always carry full segments for snakes
-                if (ss.totalSegments == 0 || ss.pointsKind != SnakePointsKind::FullSegments)
+                if (ss.totalSegments == 0 || Net::BaseKind(ss.pointsKind) != SnakePointsKind::FullSegments)
                 {
                     badPacketsDropped_++;
                     Log()->Warning("[Net] Dropped full update: invalid snake kind/segments. entityID={} totalSegments={} kind={} dropped={} seq={}",
                                    entry.entityID, ss.totalSegments, static_cast<std::uint32_t>(ss.pointsKind), badPacketsDropped_, net_.lastServerSeq);
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
-                    return;
+                    return FullApplyResult::Failed;
                 }
 
                 if (ss.pointsCount != ss.totalSegments)
@@ -779,25 +1603,49 @@ namespace Core::App::Game
                                    entry.entityID, ss.pointsCount, ss.totalSegments, badPacketsDropped_, net_.lastServerSeq);
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
-                    return;
+                    return FullApplyResult::Failed;
                 }
 
-                const auto segs = ReadSnakePoints(reader, ss.pointsCount);
-                if (segs.size() != ss.pointsCount)
+                if (!ReadSnakePoints(reader, ss, pointsScratch_))
                 {
                     badPacketsDropped_++;
                     Log()->Warning("[Net] Dropped full update: snake points read mismatch. entityID={} expectedPoints={} gotPoints={} dropped={} seq={}",
-                                   entry.entityID, ss.pointsCount, segs.size(), badPacketsDropped_, net_.lastServerSeq);
+                                   entry.entityID, ss.pointsCount, pointsScratch_.size(), badPacketsDropped_, net_.lastServerSeq);
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
-                    return;
+                    return FullApplyResult::Failed;
+                }
+
+                const bool rebuildPlayer = entry.entityID == playerEntityID_ && awaitingPlayerRebuild_;
+
+                if (const auto rec = snakeRecords_.Find(entry.entityID);
+                    rec && rec->snake && rec->lastSeenSeq > fullApply_.updateSeq && !rebuildPlayer)
+                {
+                    // a newer update moved it while the chunks were in flight: keep that state
+                    rec->fullEpoch = fullApply_.epoch;
+                    continue;
                 }
 
-                UpsertSnakeFull(entry.entityID, ss, segs, true);
+                if (IsRemovedSince(fullApply_.removedSnakes, entry.entityID, fullApply_.updateSeq))
+                {
+                    // a newer update removed it while the chunks were in flight
+                    continue;
+                }
+
+                UpsertSnakeFull(entry.entityID, ss, pointsScratch_, false);
+
+                if (const auto rec = snakeRecords_.Find(entry.entityID); rec && rec->snake)
+                {
+                    rec->fullEpoch = fullApply_.epoch;
+                    rec->lastSeenSeq = fullApply_.updateSeq;
+
+                    // exact segments: nothing left to repair
+                    pendingSnakeSnapshots_.erase(entry.entityID);
+                }
 
                 if (entry.entityID == playerEntityID_)
                 {
-                    playerBuiltExact = true;
+                    fullApply_.playerBuiltExact = true;
                 }
             }
             else if (entry.type == EntityType::Food)
@@ -810,16 +1658,25 @@ namespace Core::App::Game
                                    entry.entityID, badPacketsDropped_, net_.lastServerSeq);
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
-                    return;
+                    return FullApplyResult::Failed;
                 }
 
-                auto f = std::make_shared<EntityFood>(0, sf::Vector2f(fs.x, fs.y));
-                f->SetEntityID(entry.entityID);
+                if (const auto rec = foodRecords_.Find(entry.entityID); rec && rec->lastSeenSeq > fullApply_.updateSeq)
+                {
+                    rec->fullEpoch = fullApply_.epoch;
+                    continue;
+                }
+
+                if (IsRemovedSince(fullApply_.removedFoods, entry.entityID, fullApply_.updateSeq))
+                {
+                    continue;
+                }
 
-                foodsByID_[entry.entityID] = f;
-                foods_.insert(f);
+                UpsertFood(entry.entityID, fs, true);
 
-                foodsTTL_[entry.entityID].lastSeenSeq = net_.lastServerSeq;
+                auto& rec = *foodRecords_.Find(entry.entityID);
+                rec.fullEpoch = fullApply_.epoch;
+                rec.lastSeenSeq = fullApply_.updateSeq;
             }
             else
             {
@@ -828,13 +1685,27 @@ namespace Core::App::Game
                                static_cast<std::uint32_t>(entry.type), entry.entityID, badPacketsDropped_, net_.lastServerSeq);
                 net_.pendingFullRequest = true;
                 net_.pendingFullRequestAllSegments = true;
-                return;
+                return FullApplyResult::Failed;
             }
         }
 
+
+        return FullApplyResult::Complete;
+    }
+
+    void GameClient::FinishFullUpdate(const bool sweep)
+    {
+        if (sweep)
+        {
+            RemoveAbsentEntities(fullApply_.epoch, fullApply_.updateSeq);
+        }
+
+        fullApply_.removedSnakes.clear();
+        fullApply_.removedFoods.clear();
+
         if (awaitingPlayerRebuild_)
         {
-            if (!playerBuiltExact)
+            if (!fullApply_.playerBuiltExact)
             {
                 Log()->Warning("[Net] FullUpdate(allSegments) incomplete: player not built exact -> request again. playerID={}",
                                playerEntityID_);
@@ -850,6 +1721,140 @@ namespace Core::App::Game
         }
     }
 
+    void GameClient::ApplyFullUpdateChunk(Utils::Legacy::Game::Net::ByteReader& reader)
+    {
+        Net::FullUpdateChunkHeader ch{};
+        if (!reader.ReadPod(ch) || ch.chunkCount == 0 || ch.chunkCount > Net::MaxFullUpdateChunks || ch.chunkIndex >= ch.chunkCount)
+        {
+            badPacketsDropped_++;
+            Log()->Warning("[Net] Dropped full update chunk: bad chunk header. dropped={}", badPacketsDropped_);
+            return;
+        }
+
+        if (chunks_.hasUpdate && ch.updateID < chunks_.updateID)
+        {
+            // chunks of a slightly older update (already finished or superseded) are late duplicates;
+            // one further back than the ack window can not be a straggler: the server restarted its seq space
+            if (chunks_.updateID - ch.updateID <= UpdateWindow::AckBits)
+            {
+                return;
+            }
+
+            Log()->Warning("[Net] Chunked full update {} far behind {} -> update stream rebased",
+                           ch.updateID, chunks_.updateID);
+            RebaseUpdateStream();
+        }
+
+        if (!chunks_.hasUpdate || ch.updateID != chunks_.updateID)
+        {
+            chunks_.hasUpdate = true;
+            chunks_.active = true;
+            chunks_.updateID = ch.updateID;
+            chunks_.chunkCount = ch.chunkCount;
+            chunks_.receivedCount = 0;
+            chunks_.received.assign(ch.chunkCount, false);
+            chunks_.nackRounds = 0;
+
+            // the update takes one slot of the server update stream
+            updateWindow_.MarkReceived(ch.updateID);
+
+            if (!net_.hasSeq || ch.updateID > net_.lastServerSeq)
+            {
+                net_.hasSeq = true;
+                net_.lastServerSeq = ch.updateID;
+                DrainReorderWindow(0);
+            }
+
+            BeginFullUpdate(ch.playerEntityID, ch.updateID);
+        }
+
+        if (!chunks_.active || ch.chunkCount != chunks_.chunkCount || chunks_.received[ch.chunkIndex])
+        {
+            return;
+        }
+
+        chunks_.lastChunkAt = messageTime_;
+
+        // chunks never split an entity: each one is applied as soon as it arrives
+        const auto result = ApplyFullEntities(reader);
+        if (result == FullApplyResult::Failed)
+        {
+            chunks_.active = false;
+            return;
+        }
+
+        if (result == FullApplyResult::Truncated)
+        {
+            // leave it missing, the NACK round asks for it again
+            return;
+        }
+
+        chunks_.received[ch.chunkIndex] = true;
+        chunks_.receivedCount++;
+
+        if (chunks_.receivedCount == chunks_.chunkCount)
+        {
+            chunks_.active = false;
+            FinishFullUpdate(true);
+        }
+    }
+
+    void GameClient::NackMissingChunks()
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        const auto now = now_;
+
+        // chunks are sent back to back: a quiet gap this long means the rest is lost
+        const auto quiet = std::max<std::chrono::steady_clock::duration>(40ms, snapshotPacer_.Rto() / 4);
+        if (now - chunks_.lastChunkAt < quiet)
+        {
+            return;
+        }
+
+        constexpr std::uint32_t maxNackRounds = 4;
+        if (chunks_.nackRounds >= maxNackRounds)
+        {
+            Log()->Warning("[Net] Chunked full update {} stuck at {}/{} -> request full update",
+                           chunks_.updateID, chunks_.receivedCount, chunks_.chunkCount);
+
+            chunks_.active = false;
+            FinishFullUpdate(false);
+
+            net_.pendingFullRequest = true;
+            net_.pendingFullRequestAllSegments = true;
+            return;
+        }
+
+        chunks_.nackRounds++;
+        chunks_.lastChunkAt = now;
+
+        std::uint16_t missing = 0;
+        for (std::uint16_t i = 0; i < chunks_.chunkCount; ++i)
+        {
+            missing += chunks_.received[i] ? 0 : 1;
+        }
+
+        missing = std::min(missing, Net::MaxNackChunks);
+
+        Net::NackFullUpdateChunksPayload nack{};
+        nack.updateID = chunks_.updateID;
+        nack.count = missing;
+
+        outgoing_.Begin(Net::ToMessageType(Net::ExtMessageType::NackFullUpdateChunks));
+        outgoing_.WritePod(nack);
+
+        std::uint16_t written = 0;
+        for (std::uint16_t i = 0; i < chunks_.chunkCount && written < missing; ++i)
+        {
+            if (!chunks_.received[i])
+            {
+                outgoing_.WritePod(i);
+                written++;
+            }
+        }
+    }
+
     void GameClient::ApplySnakeSnapshot(Utils::Legacy::Game::Net::ByteReader& reader)
     {
         using namespace Utils::Legacy::Game::Net;
@@ -882,7 +1887,7 @@ namespace Core::App::Game
             return;
         }
 
-        if (ss.pointsKind != SnakePointsKind::FullSegments || ss.pointsCount != ss.totalSegments || ss.totalSegments == 0)
+        if (Net::BaseKind(ss.pointsKind) != SnakePointsKind::FullSegments || ss.pointsCount != ss.totalSegments || ss.totalSegments == 0)
         {
             badPacketsDropped_++;
             Log()->Warning("[Net] Dropped snake snapshot: invalid kind/count. entityID={} kind={} pointsCount={} totalSegments={} dropped={}",
@@ -890,16 +1895,31 @@ namespace Core::App::Game
             return;
         }
 
-        const auto segs = ReadSnakePoints(reader, ss.pointsCount);
-        if (segs.size() != ss.pointsCount)
+        if (!ReadSnakePoints(reader, ss, pointsScratch_))
         {
             badPacketsDropped_++;
             Log()->Warning("[Net] Dropped snake snapshot: points read mismatch. entityID={} expected={} got={} dropped={}",
-                           entry.entityID, ss.pointsCount, segs.size(), badPacketsDropped_);
+                           entry.entityID, ss.pointsCount, pointsScratch_.size(), badPacketsDropped_);
             return;
         }
 
-        UpsertSnakeFull(entry.entityID, ss, segs, true);
+        UpsertSnakeFull(entry.entityID, ss, pointsScratch_, true);
+
+        if (const auto rec = snakeRecords_.Find(entry.entityID); rec && rec->snapshotInFlight)
+        {
+            rec->snapshotInFlight = false;
+            snapshotsInFlight_ -= std::min<std::uint32_t>(snapshotsInFlight_, 1);
+            snapshotPacer_.OnSnapshotAnswered();
+
+            if (!rec->snapshotResent)
+            {
+                // receive time vs the AdvanceTo time of the request: clamp, the two clocks may skew
+                const auto rtt = messageTime_ - rec->snapshotRequestedAt;
+                snapshotPacer_.OnRttSample(std::max(rtt, SnapshotPacer::Clock::duration::zero()));
+            }
+
+            rec->snapshotResent = false;
+        }
     }
 
     void GameClient::ApplyPartialUpdate(Utils::Legacy::Game::Net::ByteReader& reader)
@@ -958,18 +1978,17 @@ namespace Core::App::Game
                     return;
                 }
 
-                const auto points = ReadSnakePoints(reader, ss.pointsCount);
-                if (points.size() != ss.pointsCount)
+                if (!ReadSnakePoints(reader, ss, pointsScratch_))
                 {
                     badPacketsDropped_++;
                     Log()->Warning("[Net] Dropped partial update: points read mismatch. entityID={} expectedPoints={} gotPoints={} dropped={} seq={}",
-                                   entry.entityID, ss.pointsCount, points.size(), badPacketsDropped_, net_.lastServerSeq);
+                                   entry.entityID, ss.pointsCount, pointsScratch_.size(), badPacketsDropped_, net_.lastServerSeq);
                     net_.pendingFullRequest = true;
                     net_.pendingFullRequestAllSegments = true;
                     return;
                 }
 
-                if (ss.pointsKind == SnakePointsKind::FullSegments)
+                if (Net::BaseKind(ss.pointsKind) == SnakePointsKind::FullSegments)
                 {
                     // New snake must always send full segments; also server can resend full occasionally if it wants
                     if (ss.pointsCount != ss.totalSegments)
@@ -982,12 +2001,12 @@ namespace Core::App::Game
                         return;
                     }
 
-                    UpsertSnakeFull(entry.entityID, ss, points, isNew);
+                    UpsertSnakeFull(entry.entityID, ss, pointsScratch_, isNew);
                 }
                 else
                 {
                     // Validation samples only (do not build unknown snakes!)
-                    ApplySnakeValidationUpdate(entry.entityID, ss, points, isNew);
+                    ApplySnakeValidationUpdate(entry.entityID, ss, pointsScratch_, isNew);
                 }
             }
             else if (entry.type == EntityType::Food)
@@ -1019,109 +2038,27 @@ namespace Core::App::Game
 
     // ===================== helpers (non-static) =====================
 
-    std::vector<sf::Vector2f> ReadSnakePoints(Utils::Legacy::Game::Net::ByteReader& r,
-                                             const std::uint16_t count)
+    bool ReadSnakePoints(Utils::Legacy::Game::Net::ByteReader& r,
+                         const Utils::Legacy::Game::Net::SnakeState& ss,
+                         std::vector<sf::Vector2f>& out)
     {
-        std::vector<sf::Vector2f> out;
-        out.reserve(count);
-
-        for (std::uint16_t i = 0; i < count; ++i)
-        {
-            sf::Vector2f v{};
-            if (!r.ReadVector2f(v))
-            {
-                break;
-            }
-
-            out.push_back(v);
-        }
-
-        return out;
-    }
-
-    std::vector<sf::Vector2f> BuildExpectedSamplesByRadius(const std::list<sf::Vector2f>& segments,
-                                                           const float minDist)
-    {
-        std::vector<sf::Vector2f> out;
-
-        if (segments.empty())
+        if (Net::IsDeltaKind(ss.pointsKind))
         {
-            return out;
+            return Net::ReadDeltaPoints(r, { ss.headX, ss.headY }, ss.pointsCount, out);
         }
 
-        std::vector<sf::Vector2f> segVec(segments.begin(), segments.end());
-        const std::size_t n = segVec.size();
-
-        out.reserve(n);
+        out.clear();
+        out.reserve(ss.pointsCount);
 
-        sf::Vector2f last = segVec[0];
-        out.push_back(last);
-
-        for (std::size_t i = 1; i < n; ++i)
-        {
-            const auto& p = segVec[i];
-            const float dx = p.x - last.x;
-            const float dy = p.y - last.y;
-            const float dist = std::hypot(dx, dy);
-
-            if (dist >= minDist)
-            {
-                out.push_back(p);
-                last = p;
-            }
-        }
-
-        // ensure tail included
-        if (n >= 2)
+        for (std::uint16_t i = 0; i < ss.pointsCount; ++i)
         {
-            const auto& tail = segVec.back();
-            if (out.empty() || (out.back().x != tail.x || out.back().y != tail.y))
+            sf::Vector2f v{};
+            if (!r.ReadVector2f(v))
             {
-                out.push_back(tail);
+                return false;
             }
-        }
-
-        return out;
-    }
-
-    bool ValidateSamplesByRadius(const std::list<sf::Vector2f>& predicted,
-                                 const std::vector<sf::Vector2f>& serverSamples,
-                                 const float minDist,
-                                 const float threshold)
-    {
-        if (serverSamples.empty())
-        {
-            return true;
-        }
-
-        const auto expected = BuildExpectedSamplesByRadius(predicted, minDist);
-
-        if (expected.size() != serverSamples.size())
-        {
-            Utils::Log()->Debug("expected.size() != serverSamples.size() [{} {}]", expected.size(), serverSamples.size());
-            return false;
-        }
-
-        std::size_t bad = 0;
-        const std::size_t n = expected.size();
-
-        const std::size_t allowed = std::max<std::size_t>(2, n / 10);
-
-        for (std::size_t i = 0; i < n; ++i)
-        {
-            const float dx = expected[i].x - serverSamples[i].x;
-            const float dy = expected[i].y - serverSamples[i].y;
-
-            const float dist = std::hypot(dx, dy);
 
-            if (dist > threshold)
-            {
-                bad++;
-                if (bad > allowed)
-                {
-                    return false;
-                }
-            }
+            out.push_back(v);
         }
 
         return true;
@@ -2,27 +2,39 @@
 
 #include "interfaces/game_client.hpp"
 
-#include "udp.hpp"
 #include "game_messages.hpp"
 
+#include "entity_registry.hpp"
+#include "entity_pool.hpp"
+#include "spatial_grid.hpp"
+#include "segment_ring.hpp"
+#include "drift_validation.hpp"
+#include "snapshot_pacer.hpp"
+#include "snapshot_buffer.hpp"
+#include "prediction_ring.hpp"
+#include "update_window.hpp"
+#include "outgoing_bundle.hpp"
+#include "net_protocol.hpp"
+#include "point_codec.hpp"
+#include "fixed_step.hpp"
+#include "net_worker.hpp"
+
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 
 namespace Core::App::Game
 {
-    using UdpClient   = Utils::Net::Udp::Client;
-    using UdpListener = Utils::Net::Udp::ClientListener;
-
     using EntitySnake = Utils::Legacy::Game::Entity::Snake;
     using EntityFood  = Utils::Legacy::Game::Entity::Food;
 
     class GameClient final :
         public Interface::GameClient,
         public Logic,
-        public UdpListener,
         public std::enable_shared_from_this<GameClient>
     {
-        UdpClient::Shared udpClient_;
+        // UDP I/O and header validation run on the worker's thread, see DrainNetEvents()
+        NetWorker::Shared netWorker_;
 
         EntitySnake::Shared clientSnake_;
 
@@ -35,30 +47,130 @@ namespace Core::App::Game
             bool pendingFullRequestAllSegments { false };
 
             std::uint32_t lastInputSeq { 0 };
+
+            std::uint32_t serverFeatures { Net::ServerFeature_None }; // latched from ServerFeatures
         };
 
-        struct SnakePredictState
+        // per-entity client state, one dense record per server entity
+        struct SnakeRecord
         {
-            std::uint32_t lastSeq { 0 };
+            EntitySnake::Shared snake; // null while only a snapshot request is pending
+            std::uint32_t lastSeenSeq { 0 };
+            std::uint32_t snapshotCooldownFrame { 0 }; // next frame a snapshot may be requested
+            bool snapshotInFlight { false };
+            bool snapshotResent { false }; // requested again after a timeout: no RTT sample (Karn)
+            std::uint32_t fullEpoch { 0 }; // last full update that listed this snake
+            SnapshotPacer::Clock::time_point snapshotRequestedAt;
+
+            // contiguous mirror of snake->Segments(), read by validation and rendering
+            SegmentRing body;
+
+            // remote snakes are drawn interpolationDelay_ in the past from these
+            SnapshotBuffer snapshots;
+            SegmentRing renderBody;
+
+            // body AABB (padded by radius) and the grid cells it covers
+            sf::Vector2f boundsMin;
+            sf::Vector2f boundsMax;
+            SpatialGrid::CellRange cells;
+            std::uint32_t queryStamp { 0 };
         };
 
-        struct EntityTTL
+        struct FoodRecord
         {
+            EntityFood::Shared food;
             std::uint32_t lastSeenSeq { 0 };
+            std::uint32_t fullEpoch { 0 };
+            SpatialGrid::CellRange cells;
         };
 
-        std::unordered_map<std::uint32_t, EntityTTL> snakesTTL_;
-        std::unordered_map<std::uint32_t, EntityTTL> foodsTTL_;
-
         NetState net_;
 
-        std::unordered_map<std::uint32_t, EntitySnake::Shared> snakesByID_;
-        std::unordered_map<std::uint32_t, EntityFood::Shared>  foodsByID_;
+        // everything sent in one input tick, flushed at its end
+        OutgoingBundle outgoing_;
+
+        // reorder / ack state of the update stream
+        UpdateWindow updateWindow_;
+        std::uint32_t ackSentLatest_ { 0 };
+        std::uint32_t ackSentMask_ { 0 };
 
-        std::unordered_map<std::uint32_t, SnakePredictState> predict_;
+        std::uint32_t updatesLost_ { 0 };      // holes given up on
+        std::uint32_t updatesReordered_ { 0 }; // applied from the reorder window
+        std::uint32_t updatesLate_ { 0 };      // duplicates / arrived after their slot was skipped
+
+        EntityPool<EntitySnake> snakePool_ { 64 };
+        EntityPool<EntityFood>  foodPool_ { 1024 };
+
+        EntityRegistry<SnakeRecord> snakeRecords_;
+        EntityRegistry<FoodRecord>  foodRecords_;
+
+        SpatialGrid snakeGrid_;
+        SpatialGrid foodGrid_;
+        std::uint32_t queryStamp_ { 0 };
 
         std::uint32_t playerEntityID_ { 0 };
 
+        FixedStep fixedStep_ { LogicTickRate };
+        FixedStep::Clock::time_point now_; // time passed to the current AdvanceTo, drives net timeouts
+
+        SnapshotBuffer::Clock::duration interpolationDelay_ { DefaultInterpolationDelay };
+        SnapshotBuffer::Clock::time_point messageTime_; // receive time of the message being applied
+        std::uint32_t messageAck_ { 0 };                // header.ack of the message being applied
+
+        // player prediction: the local simulation runs ahead, server state only corrects it
+        struct PredictionState
+        {
+            PredictionRing inputs;      // sent, not acked yet
+            std::uint32_t lastAck { 0 };
+            bool active { false };      // the server acks inputs, so its state can be matched to one
+
+            sf::Vector2f pending;       // correction still to blend into the head
+            sf::Vector2f applied;       // every correction applied to the head so far
+            float lastError { 0.f };
+        };
+
+        PredictionState prediction_;
+
+        std::uint32_t fullUpdateEpoch_ { 0 };
+
+        // the full update being applied (monolithic or chunked)
+        struct FullApplyState
+        {
+            std::uint32_t epoch { 0 };
+            std::uint32_t updateSeq { 0 }; // entities a newer update has seen are left alone
+            bool playerBuiltExact { false };
+
+            // entityID -> seq of the partial update that removed it while the chunks were in flight:
+            // later chunks must not bring it back
+            std::unordered_map<std::uint32_t, std::uint32_t> removedSnakes;
+            std::unordered_map<std::uint32_t, std::uint32_t> removedFoods;
+        };
+
+        enum class FullApplyResult
+        {
+            Complete,
+            Truncated, // entity list ended mid-entry
+            Failed,    // bad entity data, a new full update is already requested
+        };
+
+        // reassembly of a chunked full update (Net::ExtMessageType::FullUpdateChunk)
+        struct ChunkAssembly
+        {
+            bool hasUpdate { false };
+            bool active { false };
+
+            std::uint32_t updateID { 0 };
+            std::uint16_t chunkCount { 0 };
+            std::uint16_t receivedCount { 0 };
+            std::vector<bool> received;
+
+            std::uint32_t nackRounds { 0 };
+            std::chrono::steady_clock::time_point lastChunkAt;
+        };
+
+        FullApplyState fullApply_;
+        ChunkAssembly chunks_;
+
         float visibilityPaddingPercent_ { 0.20f };
 
         // debug / safety
@@ -68,11 +180,23 @@ namespace Core::App::Game
         std::uint32_t lastPartialPayloadBytes_ { 0 };
         std::uint32_t badPacketsDropped_ { 0 };
 
+        // load stats (GetDebugInfo)
+        std::uint64_t bytesReceived_ { 0 };
+        std::uint64_t datagramsReceived_ { 0 };
+        std::chrono::steady_clock::duration decodeTime_ { 0 };
+        std::uint32_t fullRequestsSent_ { 0 };
+        float tickLateMs_ { 0.f };
+
         bool awaitingPlayerRebuild_ { false };
 
-        // snake snapshot requests (pointed repair)
-        std::unordered_map<std::uint32_t, std::uint32_t> snakeSnapshotCooldownFrame_; // entityID -> nextAllowedFrame
+        // decode scratch (reused between datagrams, keeps capacity)
+        std::vector<sf::Vector2f> pointsScratch_;
+
+        // snake snapshot requests (pointed repair), cooldown / in-flight state lives in SnakeRecord
         std::unordered_set<std::uint32_t> pendingSnakeSnapshots_; // entityIDs to request
+        SnapshotPacer snapshotPacer_;
+        std::uint32_t snapshotsInFlight_ { 0 };
+        std::vector<std::uint32_t> snapshotBatchScratch_;
 
         std::chrono::steady_clock::time_point dateCreated = std::chrono::steady_clock::time_point::clock::now();
 
@@ -80,29 +204,82 @@ namespace Core::App::Game
         bool disconnected_ { false };
 
         std::function<void(uint64_t sessionID)> connectCallback_;
+
+        // micro-benchmarks (bench/game_client_bench.cpp) drive the decode steps directly
+        friend class GameClientBench;
     public:
         using Shared = std::shared_ptr<GameClient>;
 
+        static constexpr std::uint32_t LogicTickRate = 64;
+
+        // ~3 update intervals at 32 Hz: one late or lost update still has a snapshot to blend to
+        static constexpr std::chrono::milliseconds DefaultInterpolationDelay { 100 };
+        static constexpr std::chrono::milliseconds MaxExtrapolation { 100 };
+
+        // per tick share of a prediction error blended in (~100 ms time constant at 64 Hz);
+        // errors past the snap distance are applied at once
+        static constexpr float PredictionBlend = 0.15f;
+        static constexpr float PredictionSnapDistance = 250.f;
+
+        // how long an update past a hole waits for it: about one update interval of jitter
+        static constexpr std::chrono::milliseconds ReorderTimeout { 40 };
+
+        static constexpr std::uint32_t DefaultIoThreads = 2;
+
         GameClient();
 
-        void Initialise(std::uint8_t serverID);
+        ~GameClient();
+
+        // ioThreads: io threads of the UDP client, one is enough for a bot
+        void Initialise(std::uint8_t serverID, std::uint32_t ioThreads = DefaultIoThreads);
 
+        // pumps the network and runs every fixed tick that is due
         void ProcessTick() override;
 
-    public:
-        void OnConnected() override;
+        // ProcessTick() with `now` given by the caller; replay drives the recorded clock
+        void AdvanceTo(FixedStep::Clock::time_point now);
+
+    private:
+        // one 64 Hz simulation tick
+        void Step();
 
-        void OnDisconnected() override;
+        // applies everything the network thread queued since the last call
+        void DrainNetEvents();
 
-        void OnConnectionError(const std::string & error, bool reconnect) override;
+        // drops entities the server stopped updating that are out of view
+        void SweepStaleEntities();
 
-        void OnMessage(const std::vector<std::uint8_t>& data) override;
+        // queues an outgoing message for the network thread
+        void Send(std::span<const std::uint8_t> message);
+
+        // sends what outgoing_ collected: one datagram when the server takes bundles
+        void FlushOutgoing();
+
+        void OnConnected(std::uint64_t sessionID);
+
+        void OnDisconnected();
+
+        void OnConnectionError(const std::string & error, bool reconnect);
+
+        void ReportBadDatagram(const DatagramCheck & check);
+
+        // header already validated; bytes = whole datagram size (stats)
+        void HandleMessage(const Utils::Legacy::Game::Net::MessageHeader & header,
+                           std::span<const std::uint8_t> payload,
+                           std::size_t bytes);
+
+    public:
+        // parses and applies one raw datagram on the calling thread
+        void HandleDatagram(std::span<const std::uint8_t> data, SnapshotBuffer::Clock::time_point receivedAt);
 
         bool IsLoaded() const;
 
         bool IsTimeout() const;
 
         void SetConnectCallback(std::function<void(uint64_t sessionID)> callback);
+
+        // 0 draws remote snakes at their latest received state
+        void SetInterpolationDelay(std::chrono::milliseconds delay);
     public:
         Snake::Shared GetPlayerSnake() override;
 
@@ -110,14 +287,26 @@ namespace Core::App::Game
 
         std::unordered_set<Food::Shared> GetNearestFoods() override;
 
+        void ForEachFoodInRadius(const sf::Vector2f& center, float radius, FunctionRef<void(const Food&)> visitor) override;
+
+        void ForEachSnakeInRect(const sf::FloatRect& rect, FunctionRef<void(const Snake&, const SegmentRing&)> visitor) override;
+
+        [[nodiscard]] const SegmentRing* GetSnakeBody(std::uint32_t entityID) const override;
+
         void ForceFullUpdateRequest() override;
 
         [[nodiscard]] DebugInfo GetDebugInfo() const override;
 
         [[nodiscard]] uint32_t GetServerFrame() const override;
 
+        [[nodiscard]] float GetTickAlpha() const override;
+
 
-        static Shared Create(const BaseServiceContainer * parent, std::uint8_t serverID);
+        static Shared Create(const BaseServiceContainer * parent, std::uint8_t serverID,
+                             std::uint32_t ioThreads = DefaultIoThreads);
+
+        // no network: datagrams come in through HandleDatagram(), time through AdvanceTo()
+        static Shared CreateOffline(const BaseServiceContainer * parent);
 
     private:
         void ClearWorld();
@@ -129,24 +318,103 @@ namespace Core::App::Game
 
         void ApplySnakeValidationUpdate(const std::uint32_t entityID,
                                         const Utils::Legacy::Game::Net::SnakeState& ss,
-                                        const std::vector<sf::Vector2f>& samples,
+                                        std::span<const sf::Vector2f> samples,
                                         const bool isNew);
 
         void UpsertFood(const std::uint32_t entityID,
                         const Utils::Legacy::Game::Net::FoodState& fs,
                         const bool isNew);
 
+        // forgets the update stream position (seq, ack window, chunks, per-record seqs)
+        // before a full update from a new seq space is applied
+        void RebaseUpdateStream();
+
+        // full update sweep: drops entities not stamped with `epoch`, except those a newer
+        // update than `updateSeq` has seen
+        void RemoveAbsentEntities(std::uint32_t epoch, std::uint32_t updateSeq);
+
         void RemoveEntity(const Utils::Legacy::Game::Net::EntityType type,
                           const std::uint32_t entityID);
 
+        // Full / Partial update from the network: dropped, applied, or held until the hole
+        // before it fills
+        void ReceiveUpdate(const Utils::Legacy::Game::Net::MessageHeader& header,
+                           std::span<const std::uint8_t> payload);
+
+        // makes `header.seq` the current update seq and applies it; seqs skipped on the way are lost
+        void ApplyUpdateInOrder(const Utils::Legacy::Game::Net::MessageHeader& header,
+                                std::span<const std::uint8_t> payload);
+
+        // applies waiting updates that are next in line; holes up to `skipThrough` are given up on
+        void DrainReorderWindow(std::uint32_t skipThrough);
+
+        void SendUpdateAck();
+
         void ApplyFullUpdate(Utils::Legacy::Game::Net::ByteReader& reader);
 
+        void BeginFullUpdate(std::uint32_t playerEntityID, std::uint32_t updateSeq);
+
+        // true when a partial update newer than `updateSeq` removed `entityID`
+        static bool IsRemovedSince(const std::unordered_map<std::uint32_t, std::uint32_t>& removed,
+                                   std::uint32_t entityID,
+                                   std::uint32_t updateSeq);
+
+        // upserts the entity entries left in `reader`, stamped with fullApply_.epoch
+        FullApplyResult ApplyFullEntities(Utils::Legacy::Game::Net::ByteReader& reader);
+
+        // sweep = remove what the update did not list; then checks the player rebuild
+        void FinishFullUpdate(bool sweep);
+
+        void ApplyFullUpdateChunk(Utils::Legacy::Game::Net::ByteReader& reader);
+
+        // asks again for the chunks still missing once the stream went quiet
+        void NackMissingChunks();
+
         void ApplyPartialUpdate(Utils::Legacy::Game::Net::ByteReader& reader);
 
         void ApplySnakeSnapshot(Utils::Legacy::Game::Net::ByteReader& reader);
 
         void QueueSnakeSnapshotRequest(const std::uint32_t entityID);
 
+        // sends queued snapshot requests within the pacer budget (one batch datagram when supported)
+        void SendSnakeSnapshotRequests();
+
+        // clears requests older than the RTO and recounts snapshotsInFlight_
+        void ExpireSnakeSnapshotRequests();
+
+        void ApplyServerFeatures(Utils::Legacy::Game::Net::ByteReader& reader);
+
+        // copies the legacy segment list into rec.body (storage is reused); for full segments
+        static void SyncBody(SnakeRecord& rec);
+
+        // mirrors a body step into rec.body: new head points pushed, tail popped or grown,
+        // O(points changed); falls back to SyncBody() when the ends, or the points next to
+        // them, do not match the list (it changed some other way)
+        static void SyncBodyStep(SnakeRecord& rec);
+
+        // server head for the player (state after input messageAck_) against the prediction
+        // for that input; false while the server does not ack inputs (apply its state as is)
+        bool ReconcilePlayer(const sf::Vector2f& serverHead);
+
+        // blends part of the pending correction into the player head, once per tick
+        void ApplyPredictionCorrection();
+
+        void ResetPrediction();
+
+        // `body` slid along its own path so that it starts at the sampled head
+        static void BuildRenderBody(const SegmentRing& body, const SnapshotBuffer::Result& at, SegmentRing& out);
+
+        // recomputes the body AABB from head + points and moves the snake in snakeGrid_
+        void UpdateSnakeBounds(const std::uint32_t entityID,
+                               SnakeRecord& rec,
+                               std::span<const sf::Vector2f> points);
+
+        template <class Visitor>
+        void VisitFoodsInRadius(const sf::Vector2f& center, float radius, Visitor&& visitor);
+
+        template <class Visitor>
+        void VisitSnakesInRect(const sf::Vector2f& min, const sf::Vector2f& max, Visitor&& visitor);
+
         [[nodiscard]] float GetVisibleRadiusWithPadding() const;
 
     private:
@@ -158,14 +426,10 @@ namespace Core::App::Game
 
     // ===== helpers (non-static) =====
 
-    std::vector<sf::Vector2f> ReadSnakePoints(Utils::Legacy::Game::Net::ByteReader& r, std::uint16_t count);
-
-    std::vector<sf::Vector2f> BuildExpectedSamplesByRadius(const std::list<sf::Vector2f>& segments,
-                                                           const float minDist);
-
-    bool ValidateSamplesByRadius(const std::list<sf::Vector2f>& predicted,
-                                 const std::vector<sf::Vector2f>& serverSamples,
-                                 const float minDist,
-                                 const float threshold);
+    // reads ss.pointsCount points (raw floats or delta coded, by ss.pointsKind) into `out`
+    // (cleared first, capacity is kept); false on short read
+    bool ReadSnakePoints(Utils::Legacy::Game::Net::ByteReader& r,
+                         const Utils::Legacy::Game::Net::SnakeState& ss,
+                         std::vector<sf::Vector2f>& out);
 
 } // namespace Core::App::Game
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Core::App::Game
+{
+    // Non-owning reference to a callable, used for visitor-style queries so that
+    // passing a capturing lambda through a virtual interface never allocates.
+    template <class Signature>
+    class FunctionRef;
+
+    template <class R, class... Args>
+    class FunctionRef<R(Args...)>
+    {
+        void * object_;
+        R (*invoke_)(void *, Args...);
+
+    public:
+        template <class F>
+            requires (!std::is_same_v<std::remove_cvref_t<F>, FunctionRef> && std::is_invocable_r_v<R, F &, Args...>)
+        FunctionRef(F && f):
+            object_(const_cast<void *>(static_cast<const void *>(std::addressof(f)))),
+            invoke_([](void * object, Args... args) -> R
+            {
+                return (*static_cast<std::remove_reference_t<F> *>(object))(std::forward<Args>(args)...);
+            })
+        {
+        }
+
+        R operator()(Args... args) const
+        {
+            return invoke_(object_, std::forward<Args>(args)...);
+        }
+    };
+
+} // namespace Core::App::Game
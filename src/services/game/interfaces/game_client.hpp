@@ -7,6 +7,11 @@
 #include "legacy_logic.hpp"
 #include "legacy_entities.hpp"
 
+#include "function_ref.hpp"
+#include "../segment_ring.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+
 namespace Core::App::Game
 {
     using Logic = Utils::Legacy::Game::Logic;
@@ -33,6 +38,36 @@ namespace Core::App::Game
         std::uint32_t playerEntityID { 0 };
 
         std::uint32_t badPacketsDropped { 0 };
+
+        // snapshot repair pacing
+        float snapshotRttMs { 0.f };
+        float lossPercent { 0.f };
+        std::uint32_t snapshotWindow { 0 };
+        std::uint32_t snapshotsInFlight { 0 };
+        std::uint32_t snapshotsPending { 0 };
+
+        // network thread queues (full queue = datagram / message dropped)
+        std::uint32_t netInboundDrops { 0 };
+        std::uint32_t netOutboundDrops { 0 };
+
+        float interpolationDelayMs { 0.f };
+
+        // update stream
+        std::uint32_t updatesLost { 0 };
+        std::uint32_t updatesReordered { 0 };
+        std::uint32_t updatesLate { 0 };
+
+        // player prediction
+        float predictionError { 0.f };
+        std::uint32_t inputsUnacked { 0 };
+
+        // load, cumulative since the client was created
+        std::uint64_t bytesReceived { 0 };
+        std::uint64_t datagramsReceived { 0 };
+        std::uint64_t decodeMicros { 0 };       // spent applying datagrams
+        std::uint32_t fullRequestsSent { 0 };   // resyncs
+        std::uint64_t droppedTicks { 0 };
+        float tickLateMs { 0.f };               // how late the oldest tick of the last ProcessTick ran
     };
 
     namespace Interface {
@@ -47,11 +82,23 @@ namespace Core::App::Game
 
             virtual std::unordered_set<Food::Shared> GetNearestFoods() = 0;
 
+            // allocation-free queries over the spatial index; only the grid cells around the area are touched
+            virtual void ForEachFoodInRadius(const sf::Vector2f& center, float radius, FunctionRef<void(const Food&)> visitor) = 0;
+
+            // visitor gets the snake and its body (head first) in contiguous storage
+            virtual void ForEachSnakeInRect(const sf::FloatRect& rect, FunctionRef<void(const Snake&, const SegmentRing&)> visitor) = 0;
+
+            // nullptr for unknown entities
+            [[nodiscard]] virtual const SegmentRing* GetSnakeBody(std::uint32_t entityID) const = 0;
+
             virtual void ForceFullUpdateRequest() = 0;
 
             [[nodiscard]] virtual DebugInfo GetDebugInfo() const = 0;
 
             [[nodiscard]] virtual uint32_t GetServerFrame() const = 0;
+
+            // fraction of the next logic tick already elapsed, for render interpolation
+            [[nodiscard]] virtual float GetTickAlpha() const = 0;
         };
     }
 
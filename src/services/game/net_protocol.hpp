@@ -0,0 +1,115 @@
+#pragma once
+
+#include "game_messages.hpp"
+
+#include <cstdint>
+
+namespace Core::App::Game::Net
+{
+    // Client-side protocol extensions on top of Utils::Legacy::Game::Net.
+    // Ids live above the shared MessageType range; the server announces which of them it
+    // understands with ServerFeatures, nothing here is sent before that.
+    enum class ExtMessageType : std::uint16_t
+    {
+        ServerFeatures        = 0x40, // S -> C, ServerFeaturesPayload
+        RequestSnakeSnapshots = 0x41, // C -> S, RequestSnakeSnapshotsPayload + count * u32 entityID
+        ClientFeatures        = 0x42, // C -> S, ClientFeaturesPayload (answer to ServerFeatures)
+        FullUpdateChunk       = 0x43, // S -> C, FullUpdateChunkHeader + whole entity entries
+        NackFullUpdateChunks  = 0x44, // C -> S, NackFullUpdateChunksPayload + count * u16 chunkIndex
+        UpdateAck             = 0x45, // C -> S, UpdateAckPayload
+        Bundle                = 0x46, // C -> S, (BundleEntryHeader + bytes) * n, each entry handled as a message with the bundle's seq
+    };
+
+    enum ServerFeature : std::uint32_t
+    {
+        ServerFeature_None          = 0,
+        ServerFeature_SnapshotBatch = 1u << 0,
+        // partial updates are built against the newest state the client acked (UpdateAck) and
+        // whatever the client did not ack is sent again, so a lost update needs no resync
+        ServerFeature_AckedUpdates  = 1u << 1,
+        ServerFeature_Bundle        = 1u << 2,
+    };
+
+    // what this client can decode; the server must not use a feature the client did not announce
+    enum ClientFeature : std::uint32_t
+    {
+        ClientFeature_None              = 0,
+        ClientFeature_DeltaPoints       = 1u << 0,
+        ClientFeature_ChunkedFullUpdate = 1u << 1,
+        ClientFeature_UpdateAcks        = 1u << 2,
+    };
+
+    // SnakeState::pointsKind values beyond the shared SnakePointsKind: same meaning as
+    // FullSegments / Samples, points are DeltaPointsHeader + pointsCount * (zigzag varint dx, dy)
+    // on a 2^-quantShift grid, the first delta relative to the snake head
+    constexpr auto PointsKind_FullSegmentsDelta = static_cast<Utils::Legacy::Game::Net::SnakePointsKind>(0x10);
+    constexpr auto PointsKind_SamplesDelta      = static_cast<Utils::Legacy::Game::Net::SnakePointsKind>(0x11);
+
+    // the largest batch still fits a 1200-byte datagram with room to spare
+    constexpr std::uint16_t MaxSnapshotBatch = 128;
+
+    constexpr std::uint16_t MaxFullUpdateChunks = 1024;
+    constexpr std::uint16_t MaxNackChunks = 256;
+
+#pragma pack(push, 1)
+    struct ServerFeaturesPayload
+    {
+        std::uint32_t features { ServerFeature_None };
+    };
+
+    struct RequestSnakeSnapshotsPayload
+    {
+        std::uint16_t count { 0 };
+    };
+
+    struct ClientFeaturesPayload
+    {
+        std::uint32_t features { ClientFeature_None };
+    };
+
+    // a full update split into chunkCount datagrams; chunks never split an entity, so each
+    // one can be applied on its own. updateID is the seq the update takes in the update stream
+    struct FullUpdateChunkHeader
+    {
+        std::uint32_t updateID { 0 };
+        std::uint16_t chunkIndex { 0 };
+        std::uint16_t chunkCount { 0 };
+        std::uint32_t playerEntityID { 0 };
+    };
+
+    struct NackFullUpdateChunksPayload
+    {
+        std::uint32_t updateID { 0 };
+        std::uint16_t count { 0 };
+    };
+
+    // receive state of the update stream (seqs of FullUpdate / PartialUpdate / FullUpdateChunk)
+    struct UpdateAckPayload
+    {
+        std::uint32_t latestSeq { 0 };
+        std::uint32_t receivedMask { 0 }; // bit i: latestSeq - 1 - i received
+    };
+
+    struct BundleEntryHeader
+    {
+        std::uint16_t type { 0 };  // MessageType / ExtMessageType
+        std::uint16_t bytes { 0 }; // payload bytes that follow
+    };
+
+    struct DeltaPointsHeader
+    {
+        std::uint8_t quantShift { 3 }; // 1/8 world unit
+    };
+#pragma pack(pop)
+
+    inline Utils::Legacy::Game::Net::MessageType ToMessageType(const ExtMessageType type)
+    {
+        return static_cast<Utils::Legacy::Game::Net::MessageType>(type);
+    }
+
+    inline bool IsExt(const std::uint16_t rawType, const ExtMessageType type)
+    {
+        return rawType == static_cast<std::uint16_t>(type);
+    }
+
+} // namespace Core::App::Game::Net
@@ -0,0 +1,278 @@
+#include "net_worker.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace Core::App::Game
+{
+    DatagramCheck CheckDatagram(const std::span<const std::uint8_t> data)
+    {
+        using namespace Utils::Legacy::Game::Net;
+
+        DatagramCheck check;
+        check.bytes = data.size();
+        check.parseError = ParseHeaderDetailed(data, check.header);
+
+        if (check.parseError != ParseError::Ok)
+        {
+            // try best-effort to read type/seq from bytes when possible
+            if (data.size() >= sizeof(MessageHeader))
+            {
+                std::memcpy(&check.typeRaw, data.data() + 0, sizeof(check.typeRaw));
+                std::memcpy(&check.seqRaw, data.data() + 4, sizeof(check.seqRaw)); // after type+version (4 bytes)
+            }
+
+            return check;
+        }
+
+        // safety: ensure payloadBytes fits buffer (already guaranteed by ParseHeaderDetailed size check)
+        const std::size_t totalNeed = sizeof(MessageHeader) + static_cast<std::size_t>(check.header.payloadBytes);
+        check.outOfBounds = totalNeed > data.size();
+
+        return check;
+    }
+
+    NetLoop::NetLoop():
+        thread_([this](const std::stop_token & stop) { Run(stop); })
+    {
+    }
+
+    std::shared_ptr<NetLoop> NetLoop::Acquire()
+    {
+        static std::mutex mutex;
+        static std::weak_ptr<NetLoop> instance;
+
+        std::lock_guard lock(mutex);
+
+        auto loop = instance.lock();
+        if (!loop)
+        {
+            loop = std::make_shared<NetLoop>();
+            instance = loop;
+        }
+
+        return loop;
+    }
+
+    void NetLoop::Add(NetWorker * worker)
+    {
+        {
+            std::lock_guard lock(workersMutex_);
+            workers_.push_back(worker);
+        }
+
+        Wake();
+    }
+
+    void NetLoop::Remove(NetWorker * worker)
+    {
+        std::lock_guard lock(workersMutex_);
+        std::erase(workers_, worker);
+    }
+
+    void NetLoop::Wake()
+    {
+        {
+            std::lock_guard lock(wakeMutex_);
+            wake_ = true;
+        }
+
+        wakeCondition_.notify_one();
+    }
+
+    void NetLoop::Run(const std::stop_token & stop)
+    {
+        while (!stop.stop_requested())
+        {
+            bool activity = false;
+
+            {
+                std::lock_guard lock(workersMutex_);
+
+                for (const auto worker : workers_)
+                {
+                    activity |= worker->Poll();
+                }
+            }
+
+            if (activity)
+                continue;
+
+            std::unique_lock lock(wakeMutex_);
+            wakeCondition_.wait_for(lock, stop, IdleWait, [this] { return wake_; });
+            wake_ = false;
+        }
+    }
+
+    NetWorker::~NetWorker()
+    {
+        Stop();
+    }
+
+    bool NetWorker::StartCapture(const std::string & path)
+    {
+        return capture_.Open(path);
+    }
+
+    void NetWorker::Start(const Utils::Net::Udp::ClientConfig & config)
+    {
+        client_ = Utils::Net::Udp::Client::Create(config, shared_from_this());
+
+        loop_ = NetLoop::Acquire();
+        loop_->Add(this);
+    }
+
+    void NetWorker::Stop()
+    {
+        if (loop_)
+        {
+            loop_->Remove(this);
+            loop_.reset();
+        }
+
+        client_.reset();
+        capture_.Close();
+    }
+
+    bool NetWorker::Send(const std::span<const std::uint8_t> message)
+    {
+        const bool queued = outbound_.TryPushWith([&](std::vector<std::uint8_t> & slot)
+        {
+            slot.assign(message.begin(), message.end());
+        });
+
+        if (!queued)
+        {
+            outboundDrops_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (loop_)
+        {
+            loop_->Wake();
+        }
+
+        return queued;
+    }
+
+    bool NetWorker::Poll()
+    {
+        activity_ = false;
+
+        // delivers queued datagrams / state changes through the callbacks below
+        client_->ProcessTick();
+
+        while (auto message = outbound_.Front())
+        {
+            if (capture_.IsOpen())
+            {
+                capture_.Write(CaptureDirection::Outbound, std::chrono::steady_clock::now(), *message);
+                captureDirty_ = true;
+            }
+
+            client_->Send(*message);
+            outbound_.Pop();
+            activity_ = true;
+        }
+
+        // the capture is flushed once traffic pauses, and only if it got something
+        if (!activity_ && captureDirty_)
+        {
+            capture_.Flush();
+            captureDirty_ = false;
+        }
+
+        return activity_;
+    }
+
+    void NetWorker::PushEvent(const NetEvent::Kind kind)
+    {
+        const bool queued = inbound_.TryPushWith([&](NetEvent & event)
+        {
+            event.kind = kind;
+            event.payload.clear();
+            event.error.clear();
+        });
+
+        if (!queued)
+        {
+            inboundDrops_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void NetWorker::OnConnected()
+    {
+        const bool queued = inbound_.TryPushWith([&](NetEvent & event)
+        {
+            event.kind = NetEvent::Kind::Connected;
+            event.sessionID = client_->SessionID();
+            event.payload.clear();
+            event.error.clear();
+        });
+
+        if (!queued)
+        {
+            inboundDrops_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void NetWorker::OnDisconnected()
+    {
+        PushEvent(NetEvent::Kind::Disconnected);
+    }
+
+    void NetWorker::OnConnectionError(const std::string & error, const bool reconnect)
+    {
+        const bool queued = inbound_.TryPushWith([&](NetEvent & event)
+        {
+            event.kind = NetEvent::Kind::ConnectionError;
+            event.error = error;
+            event.reconnect = reconnect;
+            event.payload.clear();
+        });
+
+        if (!queued)
+        {
+            inboundDrops_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void NetWorker::OnMessage(const std::vector<std::uint8_t> & data)
+    {
+        activity_ = true;
+
+        const auto receivedAt = std::chrono::steady_clock::now();
+
+        if (capture_.IsOpen())
+        {
+            capture_.Write(CaptureDirection::Inbound, receivedAt, data);
+            captureDirty_ = true;
+        }
+
+        const auto check = CheckDatagram(data);
+
+        // a dropped datagram shows up as a seq gap on the game thread and is repaired from there
+        const bool queued = inbound_.TryPushWith([&](NetEvent & event)
+        {
+            event.check = check;
+            event.receivedAt = receivedAt;
+            event.error.clear();
+
+            if (!check.Ok())
+            {
+                event.kind = NetEvent::Kind::BadDatagram;
+                event.payload.clear();
+                return;
+            }
+
+            event.kind = NetEvent::Kind::Datagram;
+
+            const auto payload = std::span(data).subspan(sizeof(Utils::Legacy::Game::Net::MessageHeader), check.header.payloadBytes);
+            event.payload.assign(payload.begin(), payload.end());
+        });
+
+        if (!queued)
+        {
+            inboundDrops_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+} // namespace Core::App::Game
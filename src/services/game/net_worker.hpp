@@ -0,0 +1,171 @@
+#pragma once
+
+#include "udp.hpp"
+#include "game_messages.hpp"
+
+#include "spsc_ring.hpp"
+#include "capture_file.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // result of header / CRC / size validation of one datagram
+    struct DatagramCheck
+    {
+        Utils::Legacy::Game::Net::MessageHeader header {};
+        Utils::Legacy::Game::Net::ParseError parseError { Utils::Legacy::Game::Net::ParseError::Ok };
+        bool outOfBounds { false }; // payloadBytes past the end of the datagram
+
+        std::size_t bytes { 0 };
+        std::uint16_t typeRaw { 0 }; // best effort, for logging unparsable datagrams
+        std::uint32_t seqRaw { 0 };
+
+        [[nodiscard]] bool Ok() const
+        {
+            return parseError == Utils::Legacy::Game::Net::ParseError::Ok && !outOfBounds;
+        }
+    };
+
+    DatagramCheck CheckDatagram(std::span<const std::uint8_t> data);
+
+    // what the network thread hands to the game thread
+    struct NetEvent
+    {
+        enum class Kind : std::uint8_t
+        {
+            Connected,
+            Disconnected,
+            ConnectionError,
+            Datagram,    // check.Ok(), payload holds the message payload
+            BadDatagram, // !check.Ok()
+        };
+
+        Kind kind { Kind::Datagram };
+        DatagramCheck check;
+        std::vector<std::uint8_t> payload; // slot buffer, keeps its capacity
+        std::chrono::steady_clock::time_point receivedAt;
+
+        std::uint64_t sessionID { 0 };
+        std::string error;
+        bool reconnect { false };
+    };
+
+    class NetWorker;
+
+    // The network thread, shared by every NetWorker in the process (one per game client, a
+    // load-test bot runs hundreds). A pass polls each worker; when no worker had traffic the
+    // thread sleeps until Wake() (a message was queued) or IdleWait runs out (the UDP client
+    // only hands over datagrams when polled).
+    class NetLoop
+    {
+    public:
+        static constexpr std::chrono::microseconds IdleWait { 500 };
+
+    private:
+        std::mutex workersMutex_; // held for a whole pass
+        std::vector<NetWorker *> workers_;
+
+        std::mutex wakeMutex_;
+        std::condition_variable_any wakeCondition_;
+        bool wake_ { false };
+
+        std::jthread thread_; // last: joined before the rest is destroyed
+
+        void Run(const std::stop_token & stop);
+
+    public:
+        NetLoop();
+
+        // the process-wide loop, created on first use and stopped with its last worker
+        static std::shared_ptr<NetLoop> Acquire();
+
+        void Add(NetWorker * worker);
+
+        // once it returns the loop no longer touches `worker`
+        void Remove(NetWorker * worker);
+
+        void Wake();
+    };
+
+    // Owns the UDP client, serviced by the shared NetLoop thread. Incoming datagrams are
+    // validated there and queued for the game thread; outgoing messages are queued the other
+    // way and sent from the same thread, so the UDP client is only ever touched by one thread.
+    class NetWorker final : public Utils::Net::Udp::ClientListener, public std::enable_shared_from_this<NetWorker>
+    {
+        static constexpr std::size_t InboundCapacity = 1024;
+        static constexpr std::size_t OutboundCapacity = 256;
+
+        Utils::Net::Udp::Client::Shared client_;
+
+        SpscRing<NetEvent, InboundCapacity> inbound_;
+        SpscRing<std::vector<std::uint8_t>, OutboundCapacity> outbound_;
+
+        std::atomic<std::uint32_t> inboundDrops_ { 0 };
+        std::atomic<std::uint32_t> outboundDrops_ { 0 };
+
+        bool activity_ { false }; // network thread only
+
+        CaptureWriter capture_;   // network thread once started
+        bool captureDirty_ { false };
+
+        std::shared_ptr<NetLoop> loop_;
+
+    public:
+        using Shared = std::shared_ptr<NetWorker>;
+
+        ~NetWorker() override;
+
+        // records every datagram both ways to `path` (see capture_file.hpp); before Start()
+        bool StartCapture(const std::string & path);
+
+        void Start(const Utils::Net::Udp::ClientConfig & config);
+
+        // leaves the network thread and releases the UDP client (it holds a reference back to us)
+        void Stop();
+
+        // network thread: one pass over the UDP client and the outgoing queue; true when
+        // anything was received or sent
+        bool Poll();
+
+        // game thread: queues a message; false (and counted) when the queue is full
+        bool Send(std::span<const std::uint8_t> message);
+
+        // game thread: handler(NetEvent&) for every queued event, in arrival order
+        template <class Handler>
+        void Drain(Handler && handler)
+        {
+            while (auto event = inbound_.Front())
+            {
+                handler(*event);
+                inbound_.Pop();
+            }
+        }
+
+        [[nodiscard]] std::uint32_t InboundDrops() const { return inboundDrops_.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint32_t OutboundDrops() const { return outboundDrops_.load(std::memory_order_relaxed); }
+
+    public:
+        // UDP callbacks, network thread
+        void OnConnected() override;
+
+        void OnDisconnected() override;
+
+        void OnConnectionError(const std::string & error, bool reconnect) override;
+
+        void OnMessage(const std::vector<std::uint8_t> & data) override;
+
+    private:
+        void PushEvent(NetEvent::Kind kind);
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "game_messages.hpp"
+#include "net_protocol.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Client -> server messages of one tick, packed into as few datagrams as possible.
+    // Sub-messages are written straight into one reusable buffer (Begin + WritePod), Flush()
+    // sends them as Net::ExtMessageType::Bundle datagrams when the server understands them,
+    // otherwise one plain datagram each. Buffers keep their capacity between ticks.
+    class OutgoingBundle
+    {
+    public:
+        // bundle payload limit, keeps the datagram under a 1200-byte MTU budget
+        static constexpr std::size_t MaxPayloadBytes = 1100;
+
+    private:
+        struct Entry
+        {
+            std::uint16_t type { 0 };
+            std::uint32_t offset { 0 };
+            std::uint32_t bytes { 0 };
+            std::uint32_t seq { 0 }; // set by Flush()
+        };
+
+        std::vector<std::uint8_t> data_;    // sub-message payloads back to back
+        std::vector<Entry> entries_;
+        std::vector<std::uint8_t> payload_; // datagram payload being built
+        bool flushed_ { false };
+
+        void Append(const void * bytes, const std::size_t size)
+        {
+            const auto offset = data_.size();
+            data_.resize(offset + size);
+            std::memcpy(data_.data() + offset, bytes, size);
+        }
+
+    public:
+        OutgoingBundle()
+        {
+            data_.reserve(MaxPayloadBytes);
+            payload_.reserve(MaxPayloadBytes);
+            entries_.reserve(16);
+        }
+
+        // starts a sub-message; returns its index for SeqOf()
+        std::size_t Begin(const Utils::Legacy::Game::Net::MessageType type)
+        {
+            if (flushed_)
+            {
+                data_.clear();
+                entries_.clear();
+                flushed_ = false;
+            }
+
+            entries_.push_back({ static_cast<std::uint16_t>(type), static_cast<std::uint32_t>(data_.size()), 0, 0 });
+            return entries_.size() - 1;
+        }
+
+        // appends to the sub-message started last
+        template <class T>
+        void WritePod(const T & value)
+        {
+            Append(&value, sizeof(T));
+            entries_.back().bytes += sizeof(T);
+        }
+
+        [[nodiscard]] bool Empty() const
+        {
+            return flushed_ || entries_.empty();
+        }
+
+        // seq the sub-message went out with, valid after Flush() until the next Begin()
+        [[nodiscard]] std::uint32_t SeqOf(const std::size_t index) const
+        {
+            return entries_[index].seq;
+        }
+
+        // send(const std::vector<std::uint8_t>& datagram) for every datagram built; `seq` is
+        // the client message seq counter, advanced once per datagram
+        template <class Send>
+        void Flush(const bool bundled, std::uint32_t & seq, Send && send)
+        {
+            using namespace Utils::Legacy::Game::Net;
+
+            if (Empty())
+                return;
+
+            flushed_ = true;
+
+            // a lone message goes out as itself, no wrapper
+            if (!bundled || entries_.size() == 1)
+            {
+                for (auto & entry : entries_)
+                {
+                    payload_.assign(data_.begin() + entry.offset, data_.begin() + entry.offset + entry.bytes);
+
+                    entry.seq = ++seq;
+                    send(BuildMessage(static_cast<MessageType>(entry.type), entry.seq, 0, payload_));
+                }
+
+                return;
+            }
+
+            payload_.clear();
+            std::size_t first = 0;
+
+            auto Emit = [&](const std::size_t end)
+            {
+                ++seq;
+                for (std::size_t i = first; i < end; ++i)
+                    entries_[i].seq = seq;
+
+                send(BuildMessage(Net::ToMessageType(Net::ExtMessageType::Bundle), seq, 0, payload_));
+
+                payload_.clear();
+                first = end;
+            };
+
+            for (std::size_t i = 0; i < entries_.size(); ++i)
+            {
+                const auto & entry = entries_[i];
+
+                if (!payload_.empty() && payload_.size() + sizeof(Net::BundleEntryHeader) + entry.bytes > MaxPayloadBytes)
+                    Emit(i);
+
+                const Net::BundleEntryHeader header { entry.type, static_cast<std::uint16_t>(entry.bytes) };
+
+                const auto offset = payload_.size();
+                payload_.resize(offset + sizeof(header) + entry.bytes);
+                std::memcpy(payload_.data() + offset, &header, sizeof(header));
+                std::memcpy(payload_.data() + offset + sizeof(header), data_.data() + entry.offset, entry.bytes);
+            }
+
+            Emit(entries_.size());
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,85 @@
+#include "point_codec.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace Core::App::Game::Net
+{
+    using Utils::Legacy::Game::Net::ByteReader;
+
+    namespace
+    {
+        std::int32_t UnZigZag(const std::uint32_t v)
+        {
+            return static_cast<std::int32_t>(v >> 1) ^ -static_cast<std::int32_t>(v & 1);
+        }
+
+        // zigzag int16 needs at most 3 bytes
+        bool ReadVarint16(ByteReader& r, std::int32_t& out)
+        {
+            std::uint32_t v = 0;
+
+            for (std::uint32_t shift = 0; shift < 21; shift += 7)
+            {
+                std::uint8_t b = 0;
+                if (!r.ReadPod(b))
+                    return false;
+
+                v |= static_cast<std::uint32_t>(b & 0x7F) << shift;
+
+                if (!(b & 0x80))
+                {
+                    out = UnZigZag(v);
+                    return out >= std::numeric_limits<std::int16_t>::min() && out <= std::numeric_limits<std::int16_t>::max();
+                }
+            }
+
+            return false;
+        }
+
+        std::int32_t Quantize(const float v, const float scale)
+        {
+            return static_cast<std::int32_t>(std::lround(v * scale));
+        }
+    }
+
+    bool ReadDeltaPoints(ByteReader& r,
+                         const sf::Vector2f& head,
+                         const std::uint16_t count,
+                         std::vector<sf::Vector2f>& out)
+    {
+        out.clear();
+
+        DeltaPointsHeader dh{};
+        if (!r.ReadPod(dh) || dh.quantShift > MaxQuantShift)
+        {
+            return false;
+        }
+
+        out.reserve(count);
+
+        const float scale = static_cast<float>(1u << dh.quantShift);
+        const float invScale = 1.f / scale;
+
+        std::int32_t qx = Quantize(head.x, scale);
+        std::int32_t qy = Quantize(head.y, scale);
+
+        for (std::uint16_t i = 0; i < count; ++i)
+        {
+            std::int32_t dx = 0;
+            std::int32_t dy = 0;
+            if (!ReadVarint16(r, dx) || !ReadVarint16(r, dy))
+            {
+                return false;
+            }
+
+            qx += dx;
+            qy += dy;
+
+            out.emplace_back(static_cast<float>(qx) * invScale, static_cast<float>(qy) * invScale);
+        }
+
+        return true;
+    }
+
+} // namespace Core::App::Game::Net
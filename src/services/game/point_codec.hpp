@@ -0,0 +1,44 @@
+#pragma once
+
+#include "net_protocol.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Core::App::Game::Net
+{
+    // Snake point coding for PointsKind_*Delta: points are snapped to a 2^-quantShift grid,
+    // each one is stored as the int16 step from the previous one (the head for the first)
+    // as two zigzag varints. Body steps are a few units, so most points take 2 bytes
+    // instead of 8.
+
+    [[nodiscard]] inline bool IsDeltaKind(const Utils::Legacy::Game::Net::SnakePointsKind kind)
+    {
+        return kind == PointsKind_FullSegmentsDelta || kind == PointsKind_SamplesDelta;
+    }
+
+    // delta kinds -> the shared kind with the same meaning
+    [[nodiscard]] inline Utils::Legacy::Game::Net::SnakePointsKind BaseKind(const Utils::Legacy::Game::Net::SnakePointsKind kind)
+    {
+        using Utils::Legacy::Game::Net::SnakePointsKind;
+
+        if (kind == PointsKind_FullSegmentsDelta)
+            return SnakePointsKind::FullSegments;
+
+        if (kind == PointsKind_SamplesDelta)
+            return SnakePointsKind::Samples;
+
+        return kind;
+    }
+
+    constexpr std::uint8_t MaxQuantShift = 8;
+
+    // reads DeltaPointsHeader + `count` points into `out` (cleared first); false on short read / bad data
+    bool ReadDeltaPoints(Utils::Legacy::Game::Net::ByteReader& r,
+                         const sf::Vector2f& head,
+                         std::uint16_t count,
+                         std::vector<sf::Vector2f>& out);
+
+} // namespace Core::App::Game::Net
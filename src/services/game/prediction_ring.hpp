@@ -0,0 +1,78 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Core::App::Game
+{
+    // Inputs sent to the server and not acked yet, oldest first, with the head the local
+    // simulation had when each one went out. Entries are appended in seq order, so an ack
+    // drops a prefix. On overflow (server silent for seconds) the oldest entry is dropped.
+    class PredictionRing
+    {
+    public:
+        static constexpr std::size_t Capacity = 256; // ~8 s of input at 32 Hz
+
+        struct Entry
+        {
+            std::uint32_t seq { 0 };         // ClientInput message seq, what the server acks
+            std::uint32_t clientFrame { 0 };
+            sf::Vector2f destination;
+            sf::Vector2f head;               // predicted head when the input was sent
+            sf::Vector2f correction;         // total correction applied to the head up to then
+        };
+
+    private:
+        std::array<Entry, Capacity> entries_ {};
+        std::size_t first_ { 0 };
+        std::size_t size_ { 0 };
+
+    public:
+        void Push(const Entry & entry)
+        {
+            if (size_ == Capacity)
+            {
+                first_ = (first_ + 1) % Capacity;
+                --size_;
+            }
+
+            entries_[(first_ + size_) % Capacity] = entry;
+            ++size_;
+        }
+
+        // drops every entry up to and including `seq` and returns the newest of them: the
+        // last input the server applied (other messages share the seq counter, so `seq`
+        // need not be an input). false when nothing was dropped
+        bool Ack(const std::uint32_t seq, Entry & acked)
+        {
+            bool found = false;
+
+            // seq wraps after ~4 years at 32 Hz, plain compare is enough
+            while (size_ > 0 && entries_[first_].seq <= seq)
+            {
+                acked = entries_[first_];
+                found = true;
+
+                first_ = (first_ + 1) % Capacity;
+                --size_;
+            }
+
+            return found;
+        }
+
+        void Clear()
+        {
+            first_ = 0;
+            size_ = 0;
+        }
+
+        [[nodiscard]] std::size_t Size() const
+        {
+            return size_;
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Snake body as a ring buffer of separate x / y arrays (head = index 0, tail = size() - 1).
+    // Head insert and tail pop are O(1) and do not allocate once the capacity is reached;
+    // Runs() exposes at most two contiguous float runs for vectorised loops.
+    // begin()/end()/rbegin()/rend() keep the std::list<sf::Vector2f> shaped callers working.
+    class SegmentRing
+    {
+        std::vector<float> xs_;
+        std::vector<float> ys_;
+
+        std::size_t head_ { 0 };
+        std::size_t size_ { 0 };
+        std::size_t mask_ { 0 };
+
+    public:
+        struct Run
+        {
+            std::span<const float> xs;
+            std::span<const float> ys;
+        };
+
+        class Iterator
+        {
+            const SegmentRing * ring_ { nullptr };
+            std::ptrdiff_t index_ { 0 };
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = sf::Vector2f;
+            using difference_type = std::ptrdiff_t;
+            using reference = sf::Vector2f;
+            using pointer = void;
+
+            Iterator() = default;
+            Iterator(const SegmentRing * ring, const std::ptrdiff_t index): ring_(ring), index_(index) {}
+
+            sf::Vector2f operator*() const { return (*ring_)[static_cast<std::size_t>(index_)]; }
+            sf::Vector2f operator[](const difference_type n) const { return (*ring_)[static_cast<std::size_t>(index_ + n)]; }
+
+            Iterator & operator++() { ++index_; return *this; }
+            Iterator operator++(int) { auto tmp = *this; ++index_; return tmp; }
+            Iterator & operator--() { --index_; return *this; }
+            Iterator operator--(int) { auto tmp = *this; --index_; return tmp; }
+
+            Iterator & operator+=(const difference_type n) { index_ += n; return *this; }
+            Iterator & operator-=(const difference_type n) { index_ -= n; return *this; }
+
+            friend Iterator operator+(Iterator it, const difference_type n) { return it += n; }
+            friend Iterator operator+(const difference_type n, Iterator it) { return it += n; }
+            friend Iterator operator-(Iterator it, const difference_type n) { return it -= n; }
+            friend difference_type operator-(const Iterator & a, const Iterator & b) { return a.index_ - b.index_; }
+
+            friend bool operator==(const Iterator & a, const Iterator & b) { return a.index_ == b.index_; }
+            friend auto operator<=>(const Iterator & a, const Iterator & b) { return a.index_ <=> b.index_; }
+        };
+
+        using const_iterator = Iterator;
+        using const_reverse_iterator = std::reverse_iterator<Iterator>;
+
+        [[nodiscard]] std::size_t size() const { return size_; }
+        [[nodiscard]] bool empty() const { return size_ == 0; }
+        [[nodiscard]] std::size_t capacity() const { return xs_.size(); }
+
+        [[nodiscard]] sf::Vector2f operator[](const std::size_t i) const
+        {
+            const auto p = (head_ + i) & mask_;
+            return { xs_[p], ys_[p] };
+        }
+
+        [[nodiscard]] sf::Vector2f front() const { return (*this)[0]; }
+        [[nodiscard]] sf::Vector2f back() const { return (*this)[size_ - 1]; }
+
+        [[nodiscard]] Iterator begin() const { return { this, 0 }; }
+        [[nodiscard]] Iterator end() const { return { this, static_cast<std::ptrdiff_t>(size_) }; }
+        [[nodiscard]] const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        [[nodiscard]] const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        void Reserve(const std::size_t count)
+        {
+            if (count > capacity())
+                Regrow(count);
+        }
+
+        void Clear()
+        {
+            head_ = 0;
+            size_ = 0;
+        }
+
+        void PushFront(const sf::Vector2f & p)
+        {
+            if (size_ == capacity())
+                Regrow(size_ + 1);
+
+            head_ = (head_ - 1) & mask_;
+            xs_[head_] = p.x;
+            ys_[head_] = p.y;
+            size_++;
+        }
+
+        void PushBack(const sf::Vector2f & p)
+        {
+            if (size_ == capacity())
+                Regrow(size_ + 1);
+
+            const auto pos = (head_ + size_) & mask_;
+            xs_[pos] = p.x;
+            ys_[pos] = p.y;
+            size_++;
+        }
+
+        void PopFront()
+        {
+            head_ = (head_ + 1) & mask_;
+            size_--;
+        }
+
+        void PopBack()
+        {
+            size_--;
+        }
+
+        // replaces the content, head first; keeps the storage when it is big enough
+        template <class It>
+        void Assign(It first, const It last)
+        {
+            Clear();
+
+            if constexpr (std::random_access_iterator<It>)
+            {
+                Reserve(static_cast<std::size_t>(last - first));
+            }
+
+            for (; first != last; ++first)
+            {
+                PushBack(*first);
+            }
+        }
+
+        // [head .. end of storage) and the wrapped remainder; the second run is empty when linear
+        [[nodiscard]] std::array<Run, 2> Runs() const
+        {
+            const auto first = std::min(size_, capacity() - head_);
+
+            return {{
+                { std::span(xs_).subspan(head_, first), std::span(ys_).subspan(head_, first) },
+                { std::span(xs_).first(size_ - first), std::span(ys_).first(size_ - first) },
+            }};
+        }
+
+    private:
+        void Regrow(const std::size_t minCapacity)
+        {
+            const auto newCapacity = std::bit_ceil(std::max<std::size_t>(minCapacity, 16));
+
+            std::vector<float> xs(newCapacity);
+            std::vector<float> ys(newCapacity);
+
+            for (std::size_t i = 0; i < size_; ++i)
+            {
+                const auto p = (head_ + i) & mask_;
+                xs[i] = xs_[p];
+                ys[i] = ys_[p];
+            }
+
+            xs_ = std::move(xs);
+            ys_ = std::move(ys);
+            head_ = 0;
+            mask_ = newCapacity - 1;
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+namespace Core::App::Game
+{
+    // Timestamped head positions of one remote snake, newest last.
+    // Sample() answers "where was the head at renderTime": cubic Hermite between the two
+    // bracketing snapshots (Catmull-Rom tangents), and the end tangent followed for at
+    // most maxExtrapolation past the newest one when updates are late.
+    // The odometer (head path length) tells how far the rendered head trails the newest
+    // one along the body, which is what the body is shifted by.
+    class SnapshotBuffer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t Capacity = 16;
+
+        struct Result
+        {
+            sf::Vector2f head;
+            float behind { 0.f }; // path length from the newest head back to `head`; < 0 ahead of it
+            bool extrapolated { false };
+        };
+
+    private:
+        struct Snapshot
+        {
+            Clock::time_point time;
+            sf::Vector2f head;
+            float odometer { 0.f };
+        };
+
+        std::array<Snapshot, Capacity> snapshots_ {};
+        std::size_t first_ { 0 };
+        std::size_t size_ { 0 };
+
+        [[nodiscard]] const Snapshot& At(const std::size_t i) const
+        {
+            return snapshots_[(first_ + i) % Capacity];
+        }
+
+        static float Seconds(const Clock::duration d)
+        {
+            return std::chrono::duration<float>(d).count();
+        }
+
+        static float Length(const sf::Vector2f v)
+        {
+            return std::sqrt(v.x * v.x + v.y * v.y);
+        }
+
+        // world units per second at snapshot i
+        [[nodiscard]] sf::Vector2f Tangent(const std::size_t i) const
+        {
+            const std::size_t a = (i == 0) ? 0 : i - 1;
+            const std::size_t b = std::min(i + 1, size_ - 1);
+
+            const float dt = Seconds(At(b).time - At(a).time);
+            if (dt <= 0.f)
+                return {};
+
+            return (At(b).head - At(a).head) / dt;
+        }
+
+        // segment k -> k + 1 at u in [0, 1]
+        [[nodiscard]] sf::Vector2f Hermite(const std::size_t k, const float u) const
+        {
+            const auto& p0 = At(k);
+            const auto& p1 = At(k + 1);
+            const float h = Seconds(p1.time - p0.time);
+
+            const float u2 = u * u;
+            const float u3 = u2 * u;
+
+            const float h00 = 2.f * u3 - 3.f * u2 + 1.f;
+            const float h10 = u3 - 2.f * u2 + u;
+            const float h01 = -2.f * u3 + 3.f * u2;
+            const float h11 = u3 - u2;
+
+            return p0.head * h00 + Tangent(k) * (h10 * h) + p1.head * h01 + Tangent(k + 1) * (h11 * h);
+        }
+
+    public:
+        void Push(Clock::time_point time, const sf::Vector2f head)
+        {
+            float odometer = 0.f;
+
+            if (size_ > 0)
+            {
+                const auto& newest = At(size_ - 1);
+
+                // two datagrams drained in the same frame: keep times strictly increasing
+                time = std::max(time, newest.time + std::chrono::microseconds(1));
+                odometer = newest.odometer + Length(head - newest.head);
+            }
+
+            if (size_ == Capacity)
+            {
+                first_ = (first_ + 1) % Capacity;
+                --size_;
+            }
+
+            snapshots_[(first_ + size_) % Capacity] = Snapshot { time, head, odometer };
+            ++size_;
+        }
+
+        void Reset()
+        {
+            first_ = 0;
+            size_ = 0;
+        }
+
+        [[nodiscard]] bool Empty() const
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] Result Sample(const Clock::time_point renderTime, const Clock::duration maxExtrapolation) const
+        {
+            if (size_ == 0)
+                return {};
+
+            const auto& newest = At(size_ - 1);
+
+            if (size_ == 1)
+                return { newest.head, 0.f, false };
+
+            const auto& oldest = At(0);
+            if (renderTime <= oldest.time)
+                return { oldest.head, newest.odometer - oldest.odometer, false };
+
+            if (renderTime >= newest.time)
+            {
+                // continue along the spline's end tangent: C1 with the last segment, and
+                // unlike the cubic itself it does not run away past its end
+                const float ahead = Seconds(std::min(renderTime - newest.time, maxExtrapolation));
+
+                const auto head = newest.head + Tangent(size_ - 1) * ahead;
+                return { head, -Length(head - newest.head), ahead > 0.f };
+            }
+
+            // renderTime is usually within the last few snapshots
+            std::size_t k = size_ - 2;
+            while (k > 0 && At(k).time > renderTime)
+                --k;
+
+            const auto& p0 = At(k);
+            const auto& p1 = At(k + 1);
+            const float u = Seconds(renderTime - p0.time) / Seconds(p1.time - p0.time);
+
+            const float odometer = p0.odometer + (p1.odometer - p0.odometer) * u;
+            return { Hermite(k, u), newest.odometer - odometer, false };
+        }
+    };
+
+} // namespace Core::App::Game
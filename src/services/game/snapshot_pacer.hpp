@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace Core::App::Game
+{
+    // Pacing for snake snapshot repair.
+    // RTT is measured request -> snapshot (SRTT / RTTVAR as in RFC 6298, no samples from
+    // re-sent requests, RTO doubled on timeout), loss from server seq gaps (EWMA). The number
+    // of outstanding requests is an AIMD window: +1 per answered snapshot, halved at most once
+    // per RTO when requests time out, scaled down further by the current loss.
+    class SnapshotPacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::uint32_t MinWindow = 4;
+        static constexpr std::uint32_t MaxWindow = 128;
+        static constexpr std::uint32_t InitialWindow = 16;
+
+        static constexpr float MinRtoMs = 100.f;
+        static constexpr float MaxRtoMs = 2000.f;
+        static constexpr float TickMs = 1000.f / 64.f; // logic tick
+
+    private:
+        float srttMs_ { 0.f };
+        float rttVarMs_ { 0.f };
+        bool hasRtt_ { false };
+
+        float loss_ { 0.f };
+
+        float window_ { static_cast<float>(InitialWindow) };
+
+        float backoff_ { 1.f };      // RTO multiplier, doubled per timeout, reset by an RTT sample
+        Clock::time_point lastTimeoutAt_;
+        bool hasTimeout_ { false };
+
+    public:
+        void Reset()
+        {
+            *this = SnapshotPacer{};
+        }
+
+        // lost = updates skipped before this one (seq gap)
+        void OnUpdateReceived(const std::uint32_t lost)
+        {
+            constexpr float alpha = 1.f / 16.f;
+
+            const float sample = static_cast<float>(lost) / static_cast<float>(lost + 1);
+            loss_ += alpha * (sample - loss_);
+        }
+
+        void OnSnapshotAnswered()
+        {
+            window_ = std::min(window_ + 1.f, static_cast<float>(MaxWindow));
+        }
+
+        // only for answers to requests sent once (Karn): a re-sent one can not tell which it answers
+        void OnRttSample(const Clock::duration rtt)
+        {
+            const float ms = std::chrono::duration<float, std::milli>(rtt).count();
+
+            if (!hasRtt_)
+            {
+                srttMs_ = ms;
+                rttVarMs_ = ms * 0.5f;
+                hasRtt_ = true;
+            }
+            else
+            {
+                rttVarMs_ += 0.25f * (std::abs(srttMs_ - ms) - rttVarMs_);
+                srttMs_ += 0.125f * (ms - srttMs_);
+            }
+
+            backoff_ = 1.f;
+        }
+
+        // one loss event per RTO: a lost batch of requests times out together
+        void OnSnapshotTimedOut(const Clock::time_point now)
+        {
+            if (hasTimeout_ && now - lastTimeoutAt_ < Rto())
+            {
+                return;
+            }
+
+            hasTimeout_ = true;
+            lastTimeoutAt_ = now;
+
+            window_ = std::max(window_ * 0.5f, static_cast<float>(MinWindow));
+            backoff_ = std::min(backoff_ * 2.f, MaxRtoMs / MinRtoMs);
+        }
+
+        [[nodiscard]] Clock::duration Rto() const
+        {
+            const float base = hasRtt_ ? srttMs_ + 4.f * rttVarMs_ : 1000.f;
+            const float ms = std::clamp(base * backoff_, MinRtoMs, MaxRtoMs);
+            return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(ms));
+        }
+
+        // per-snake cooldown between two requests, in logic frames
+        [[nodiscard]] std::uint32_t RetryFrames() const
+        {
+            const float ms = std::chrono::duration<float, std::milli>(Rto()).count();
+            return static_cast<std::uint32_t>(std::ceil(ms / TickMs));
+        }
+
+        // how many more requests may be sent now
+        [[nodiscard]] std::uint32_t Budget(const std::uint32_t inFlight) const
+        {
+            const auto window = std::max(static_cast<std::uint32_t>(window_ * (1.f - loss_)), MinWindow);
+            return window > inFlight ? window - inFlight : 0;
+        }
+
+        [[nodiscard]] float SrttMs() const { return srttMs_; }
+        [[nodiscard]] float Loss() const { return loss_; }
+        [[nodiscard]] std::uint32_t Window() const { return static_cast<std::uint32_t>(window_); }
+    };
+
+} // namespace Core::App::Game
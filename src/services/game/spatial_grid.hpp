@@ -0,0 +1,167 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Uniform grid over the arena bounding box. Keys are entity IDs; an entity covers an
+    // inclusive range of cells (one cell for foods, its body AABB for snakes).
+    // Positions outside the arena are clamped into the border cells.
+    class SpatialGrid
+    {
+    public:
+        struct CellRange
+        {
+            std::int32_t x0 { 0 };
+            std::int32_t y0 { 0 };
+            std::int32_t x1 { -1 };
+            std::int32_t y1 { -1 };
+
+            [[nodiscard]] bool Valid() const
+            {
+                return x0 <= x1 && y0 <= y1;
+            }
+
+            bool operator==(const CellRange &) const = default;
+        };
+
+    private:
+        sf::Vector2f origin_;
+        float cellSize_;
+        float invCellSize_;
+
+        std::int32_t cols_;
+        std::int32_t rows_;
+
+        std::vector<std::vector<std::uint32_t>> cells_;
+
+    public:
+        SpatialGrid(const sf::Vector2f & center, const float halfExtent, const float cellSize):
+            origin_(center.x - halfExtent, center.y - halfExtent),
+            cellSize_(cellSize),
+            invCellSize_(1.f / cellSize),
+            cols_(std::max(1, static_cast<std::int32_t>(std::ceil(halfExtent * 2.f / cellSize)))),
+            rows_(cols_),
+            cells_(static_cast<std::size_t>(cols_) * static_cast<std::size_t>(rows_))
+        {
+        }
+
+        [[nodiscard]] float CellSize() const
+        {
+            return cellSize_;
+        }
+
+        [[nodiscard]] CellRange RangeOf(const sf::Vector2f & min, const sf::Vector2f & max) const
+        {
+            return {
+                ClampX((min.x - origin_.x) * invCellSize_),
+                ClampY((min.y - origin_.y) * invCellSize_),
+                ClampX((max.x - origin_.x) * invCellSize_),
+                ClampY((max.y - origin_.y) * invCellSize_),
+            };
+        }
+
+        [[nodiscard]] CellRange RangeOf(const sf::Vector2f & pos) const
+        {
+            return RangeOf(pos, pos);
+        }
+
+        void Insert(const std::uint32_t key, const CellRange & range)
+        {
+            for (std::int32_t y = range.y0; y <= range.y1; ++y)
+            {
+                for (std::int32_t x = range.x0; x <= range.x1; ++x)
+                {
+                    Cell(x, y).push_back(key);
+                }
+            }
+        }
+
+        void Remove(const std::uint32_t key, const CellRange & range)
+        {
+            for (std::int32_t y = range.y0; y <= range.y1; ++y)
+            {
+                for (std::int32_t x = range.x0; x <= range.x1; ++x)
+                {
+                    auto & cell = Cell(x, y);
+
+                    const auto it = std::find(cell.begin(), cell.end(), key);
+                    if (it != cell.end())
+                    {
+                        *it = cell.back();
+                        cell.pop_back();
+                    }
+                }
+            }
+        }
+
+        // no-op when the entity stays inside the same cells
+        void Move(const std::uint32_t key, const CellRange & from, const CellRange & to)
+        {
+            if (from == to)
+                return;
+
+            Remove(key, from);
+            Insert(key, to);
+        }
+
+        // visitor(key); a key spanning several cells is reported once per cell
+        template <class Visitor>
+        void ForEachInRange(const CellRange & range, Visitor && visitor) const
+        {
+            for (std::int32_t y = range.y0; y <= range.y1; ++y)
+            {
+                for (std::int32_t x = range.x0; x <= range.x1; ++x)
+                {
+                    for (const auto key : Cell(x, y))
+                    {
+                        visitor(key);
+                    }
+                }
+            }
+        }
+
+        void Clear()
+        {
+            // keep per-cell capacity, the world refills the same cells
+            for (auto & cell : cells_)
+            {
+                cell.clear();
+            }
+        }
+
+    private:
+        [[nodiscard]] std::int32_t ClampX(const float v) const
+        {
+            if (!(v >= 0.f)) // also catches NaN
+                return 0;
+
+            return static_cast<std::int32_t>(std::min(std::floor(v), static_cast<float>(cols_ - 1)));
+        }
+
+        [[nodiscard]] std::int32_t ClampY(const float v) const
+        {
+            if (!(v >= 0.f)) // also catches NaN
+                return 0;
+
+            return static_cast<std::int32_t>(std::min(std::floor(v), static_cast<float>(rows_ - 1)));
+        }
+
+        std::vector<std::uint32_t> & Cell(const std::int32_t x, const std::int32_t y)
+        {
+            return cells_[static_cast<std::size_t>(y) * static_cast<std::size_t>(cols_) + static_cast<std::size_t>(x)];
+        }
+
+        [[nodiscard]] const std::vector<std::uint32_t> & Cell(const std::int32_t x, const std::int32_t y) const
+        {
+            return cells_[static_cast<std::size_t>(y) * static_cast<std::size_t>(cols_) + static_cast<std::size_t>(x)];
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace Core::App::Game
+{
+    // Wait-free single producer / single consumer ring.
+    // Slots are constructed once and reused: the producer fills a slot in place
+    // (TryPushWith) and the consumer reads it in place (Front / Pop), so element
+    // buffers keep their capacity and steady-state traffic does not allocate.
+    template <class T, std::size_t Capacity>
+    class SpscRing
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        static constexpr std::size_t Mask = Capacity - 1;
+        static constexpr std::size_t CacheLine = 64;
+
+        alignas(CacheLine) std::atomic<std::size_t> head_ { 0 }; // consumer position
+        alignas(CacheLine) std::size_t cachedTail_ { 0 };        // consumer's view of tail_
+
+        alignas(CacheLine) std::atomic<std::size_t> tail_ { 0 }; // producer position
+        alignas(CacheLine) std::size_t cachedHead_ { 0 };        // producer's view of head_
+
+        alignas(CacheLine) std::array<T, Capacity> slots_ {};
+
+    public:
+        // producer: fill(T& slot) writes the element in place; false when the ring is full
+        template <class Fill>
+        bool TryPushWith(Fill && fill)
+        {
+            const auto tail = tail_.load(std::memory_order_relaxed);
+
+            if (tail - cachedHead_ == Capacity)
+            {
+                cachedHead_ = head_.load(std::memory_order_acquire);
+                if (tail - cachedHead_ == Capacity)
+                    return false;
+            }
+
+            fill(slots_[tail & Mask]);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // consumer: oldest element or nullptr; stays valid until Pop()
+        T * Front()
+        {
+            const auto head = head_.load(std::memory_order_relaxed);
+
+            if (head == cachedTail_)
+            {
+                cachedTail_ = tail_.load(std::memory_order_acquire);
+                if (head == cachedTail_)
+                    return nullptr;
+            }
+
+            return &slots_[head & Mask];
+        }
+
+        // consumer
+        void Pop()
+        {
+            head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        // approximate from any thread
+        [[nodiscard]] std::size_t SizeApprox() const
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "game_messages.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Core::App::Game
+{
+    // Receive side of the server update stream.
+    // - ack state: newest seq seen plus a bit per each of the 32 seqs before it, which is
+    //   what the server is told (Net::UpdateAckPayload) and how duplicates are spotted;
+    // - reorder window: updates that arrived past a hole wait here (payload copied into
+    //   reused slots) until the hole fills or its wait runs out.
+    class UpdateWindow
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::uint32_t AckBits = 32;
+        static constexpr std::uint32_t ReorderSlots = 8;
+
+        struct Slot
+        {
+            Utils::Legacy::Game::Net::MessageHeader header {}; // packed, kept first so it stays aligned
+            bool used { false };
+            std::vector<std::uint8_t> payload;
+            Clock::time_point receivedAt;
+        };
+
+    private:
+        std::uint32_t latest_ { 0 };
+        std::uint32_t mask_ { 0 }; // bit i: latest_ - 1 - i received
+        bool any_ { false };
+
+        std::array<Slot, ReorderSlots> slots_ {};
+
+    public:
+        // false when `seq` was already received (or is too old to tell: treated the same)
+        bool MarkReceived(const std::uint32_t seq)
+        {
+            if (!any_)
+            {
+                any_ = true;
+                latest_ = seq;
+                mask_ = 0;
+                return true;
+            }
+
+            if (seq > latest_)
+            {
+                const std::uint32_t shift = seq - latest_;
+                if (shift > AckBits)
+                {
+                    mask_ = 0;
+                }
+                else
+                {
+                    // the old latest becomes bit shift - 1
+                    mask_ = (shift == AckBits) ? 0 : mask_ << shift;
+                    mask_ |= 1u << (shift - 1);
+                }
+
+                latest_ = seq;
+                return true;
+            }
+
+            if (seq == latest_)
+                return false;
+
+            const std::uint32_t back = latest_ - seq;
+            if (back > AckBits)
+                return false;
+
+            const std::uint32_t bit = 1u << (back - 1);
+            if (mask_ & bit)
+                return false;
+
+            mask_ |= bit;
+            return true;
+        }
+
+        [[nodiscard]] std::uint32_t Latest() const { return latest_; }
+        [[nodiscard]] std::uint32_t Mask() const { return mask_; }
+        [[nodiscard]] bool Any() const { return any_; }
+
+        // the caller keeps seqs within ReorderSlots of the hole, so a free slot always exists;
+        // false for a seq that is already waiting
+        bool Stash(const Utils::Legacy::Game::Net::MessageHeader & header,
+                   const std::span<const std::uint8_t> payload,
+                   const Clock::time_point receivedAt)
+        {
+            Slot * free = nullptr;
+
+            for (auto & slot : slots_)
+            {
+                if (slot.used && slot.header.seq == header.seq)
+                    return false;
+
+                if (!slot.used && !free)
+                    free = &slot;
+            }
+
+            if (!free)
+                return false;
+
+            free->used = true;
+            free->header = header;
+            free->payload.assign(payload.begin(), payload.end());
+            free->receivedAt = receivedAt;
+            return true;
+        }
+
+        // lowest waiting seq, nullptr when empty
+        [[nodiscard]] Slot * Oldest()
+        {
+            Slot * oldest = nullptr;
+
+            for (auto & slot : slots_)
+            {
+                if (slot.used && (!oldest || slot.header.seq < oldest->header.seq))
+                    oldest = &slot;
+            }
+
+            return oldest;
+        }
+
+        static void Release(Slot & slot)
+        {
+            slot.used = false;
+            slot.payload.clear();
+        }
+
+        // highest waiting seq that has waited `timeout` already, 0 when none
+        [[nodiscard]] std::uint32_t ExpiredThrough(const Clock::time_point now, const Clock::duration timeout) const
+        {
+            std::uint32_t through = 0;
+
+            for (const auto & slot : slots_)
+            {
+                const std::uint32_t seq = slot.header.seq;
+                if (slot.used && now - slot.receivedAt >= timeout)
+                    through = std::max(through, seq);
+            }
+
+            return through;
+        }
+
+        void Clear()
+        {
+            latest_ = 0;
+            mask_ = 0;
+            any_ = false;
+
+            for (auto & slot : slots_)
+                Release(slot);
+        }
+    };
+
+} // namespace Core::App::Game
@@ -0,0 +1,216 @@
+#include "arena_background.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core::App::Render::Batch {
+
+    namespace
+    {
+        constexpr float FadeEdge = ArenaBackground::Tile * 1.25f;     // допуск на край круга (чтобы не было дыр)
+        constexpr float MaskThickness = ArenaBackground::Tile * 1.30f;
+        constexpr float ChunkSize = ArenaBackground::Tile * ArenaBackground::ChunkTiles;
+
+        constexpr unsigned MaskPoints = 220;
+        constexpr unsigned GlowPoints = 160;
+        constexpr unsigned BorderPoints = 200;
+
+        const sf::Color BackgroundColor(6, 7, 10, 255);
+
+        float Len(const sf::Vector2f & v)
+        {
+            return std::sqrt(v.x * v.x + v.y * v.y);
+        }
+
+        // annulus from `inner` to `outer` as triangles, appended so rings share one draw
+        void AppendRing(sf::VertexArray & vertices, const sf::Vector2f & center, const float inner, const float outer,
+                        const unsigned points, const sf::Color & color)
+        {
+            constexpr float Pi2 = 6.28318530718f;
+
+            for (unsigned i = 0; i < points; ++i)
+            {
+                const float a0 = Pi2 * static_cast<float>(i) / static_cast<float>(points);
+                const float a1 = Pi2 * static_cast<float>(i + 1) / static_cast<float>(points);
+
+                const sf::Vector2f d0(std::cos(a0), std::sin(a0));
+                const sf::Vector2f d1(std::cos(a1), std::sin(a1));
+
+                const sf::Vertex i0(center + d0 * inner, color);
+                const sf::Vertex o0(center + d0 * outer, color);
+                const sf::Vertex i1(center + d1 * inner, color);
+                const sf::Vertex o1(center + d1 * outer, color);
+
+                vertices.append(i0);
+                vertices.append(o0);
+                vertices.append(o1);
+
+                vertices.append(i0);
+                vertices.append(o1);
+                vertices.append(i1);
+            }
+        }
+
+        std::uint64_t ChunkKey(const int cx, const int cy)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) | static_cast<std::uint32_t>(cy);
+        }
+    }
+
+    void ArenaBackground::SetArena(const sf::Vector2f & center, const float radius)
+    {
+        center_ = center;
+        radius_ = radius;
+
+        chunks_.clear();
+        borderZoom_ = -1.f;
+
+        // Mask ring (covers chessboard corners outside the circle)
+        mask_.clear();
+        const float r = radius_ + MaskThickness * 0.5f;
+        AppendRing(mask_, center_, r, r + MaskThickness, MaskPoints, BackgroundColor);
+    }
+
+    void ArenaBackground::BuildChunk(Chunk & chunk, const int cx, const int cy) const
+    {
+        const sf::Color cA(12, 14, 20, 255);
+        const sf::Color cB(16, 18, 26, 255);
+
+        // мягкие “швы” (очень лёгкие линии)
+        const sf::Color seamCol(255, 255, 255, 8);
+
+        for (int ty = 0; ty < ChunkTiles; ++ty)
+        {
+            for (int tx = 0; tx < ChunkTiles; ++tx)
+            {
+                const int ix = cx * ChunkTiles + tx;
+                const int iy = cy * ChunkTiles + ty;
+
+                const float x = static_cast<float>(ix) * Tile;
+                const float y = static_cast<float>(iy) * Tile;
+
+                const sf::Vector2f center { x + Tile * 0.5f, y + Tile * 0.5f };
+                const float dist = Len(center - center_);
+
+                // грубый клип по кругу (берём тайлы около края тоже)
+                if (dist > radius_ + FadeEdge)
+                    continue;
+
+                const bool odd = ((ix + iy) & 1) != 0;
+                sf::Color col = odd ? cA : cB;
+
+                // лёгкая виньетка по расстоянию от центра (даёт объём), темнее ближе к краю
+                const float dark = 1.f - std::clamp(dist / radius_, 0.f, 1.f) * 0.20f;
+                col.r = static_cast<sf::Uint8>(static_cast<float>(col.r) * dark);
+                col.g = static_cast<sf::Uint8>(static_cast<float>(col.g) * dark);
+                col.b = static_cast<sf::Uint8>(static_cast<float>(col.b) * dark);
+
+                chunk.quads.emplace_back(sf::Vector2f(x,        y       ), col);
+                chunk.quads.emplace_back(sf::Vector2f(x + Tile, y       ), col);
+                chunk.quads.emplace_back(sf::Vector2f(x + Tile, y + Tile), col);
+                chunk.quads.emplace_back(sf::Vector2f(x,        y + Tile), col);
+
+                // вертикальная справа, горизонтальная снизу
+                chunk.seams.emplace_back(sf::Vector2f(x + Tile, y       ), seamCol);
+                chunk.seams.emplace_back(sf::Vector2f(x + Tile, y + Tile), seamCol);
+                chunk.seams.emplace_back(sf::Vector2f(x,        y + Tile), seamCol);
+                chunk.seams.emplace_back(sf::Vector2f(x + Tile, y + Tile), seamCol);
+            }
+        }
+
+        if (chunk.quads.empty() || !sf::VertexBuffer::isAvailable())
+            return;
+
+        // the CPU copy stays as the fallback if the upload fails
+        chunk.buffered = chunk.quadBuffer.create(chunk.quads.size()) && chunk.quadBuffer.update(chunk.quads.data())
+                      && chunk.seamBuffer.create(chunk.seams.size()) && chunk.seamBuffer.update(chunk.seams.data());
+    }
+
+    ArenaBackground::Chunk & ArenaBackground::GetChunk(const int cx, const int cy)
+    {
+        const auto [it, inserted] = chunks_.try_emplace(ChunkKey(cx, cy));
+        if (inserted)
+        {
+            BuildChunk(it->second, cx, cy);
+        }
+        return it->second;
+    }
+
+    void ArenaBackground::BuildBorder(const float zoom)
+    {
+        borderZoom_ = zoom;
+        glow_.clear();
+        border_.clear();
+
+        const float baseThickness = 16.f * zoom; // держим “пиксельный” размер примерно постоянным
+
+        // glow layers (additive), чуть “малиновый”
+        for (int i = 0; i < 5; ++i)
+        {
+            const float t = static_cast<float>(i);
+            const float thick = baseThickness + (22.f * zoom) + t * (18.f * zoom);
+            AppendRing(glow_, center_, radius_, radius_ + thick, GlowPoints,
+                       sf::Color(255, 60, 80, static_cast<sf::Uint8>(70 - i * 12)));
+        }
+
+        // main ring
+        AppendRing(border_, center_, radius_, radius_ + baseThickness, BorderPoints, sf::Color(255, 80, 90, 230));
+    }
+
+    void ArenaBackground::Draw(sf::RenderTarget & target, const sf::View & view, const float zoom)
+    {
+        // ==========================
+        // Checkerboard floor: chunks in view, clipped by the circle's bounding box
+        // ==========================
+        const sf::Vector2f viewCenter = view.getCenter();
+        const sf::Vector2f viewSize = view.getSize();
+
+        const float clipMinX = std::max(viewCenter.x - viewSize.x * 0.5f, center_.x - radius_ - Tile);
+        const float clipMaxX = std::min(viewCenter.x + viewSize.x * 0.5f, center_.x + radius_ + Tile);
+        const float clipMinY = std::max(viewCenter.y - viewSize.y * 0.5f, center_.y - radius_ - Tile);
+        const float clipMaxY = std::min(viewCenter.y + viewSize.y * 0.5f, center_.y + radius_ + Tile);
+
+        if (clipMinX < clipMaxX && clipMinY < clipMaxY)
+        {
+            const int cx0 = static_cast<int>(std::floor(clipMinX / ChunkSize));
+            const int cx1 = static_cast<int>(std::floor(clipMaxX / ChunkSize));
+            const int cy0 = static_cast<int>(std::floor(clipMinY / ChunkSize));
+            const int cy1 = static_cast<int>(std::floor(clipMaxY / ChunkSize));
+
+            for (int cy = cy0; cy <= cy1; ++cy)
+            {
+                for (int cx = cx0; cx <= cx1; ++cx)
+                {
+                    const Chunk & chunk = GetChunk(cx, cy);
+                    if (chunk.quads.empty())
+                        continue;
+
+                    if (chunk.buffered)
+                    {
+                        target.draw(chunk.quadBuffer);
+                        target.draw(chunk.seamBuffer);
+                    }
+                    else
+                    {
+                        target.draw(chunk.quads.data(), chunk.quads.size(), sf::Quads);
+                        target.draw(chunk.seams.data(), chunk.seams.size(), sf::Lines);
+                    }
+                }
+            }
+        }
+
+        target.draw(mask_);
+
+        // ==========================
+        // Border: energy ring + main ring
+        // ==========================
+        if (zoom != borderZoom_)
+        {
+            BuildBorder(zoom);
+        }
+
+        target.draw(glow_, sf::RenderStates(sf::BlendAdd));
+        target.draw(border_);
+    }
+
+} // namespace Core::App::Render::Batch
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Core::App::Render::Batch {
+
+    // The arena floor, the mask around it and the border, from cached geometry.
+    //
+    // The checkerboard is built per chunk of ChunkTiles x ChunkTiles tiles the first time
+    // the chunk is in view and kept (in a static vertex buffer where supported); a frame
+    // only draws the chunks it sees. The mask ring never changes, the border rings only
+    // depend on zoom and are rebuilt when it changes.
+    class ArenaBackground
+    {
+    public:
+        static constexpr float Tile = 220.f;        // размер клетки шахматки (в world units)
+        static constexpr int ChunkTiles = 8;
+
+    private:
+        struct Chunk
+        {
+            std::vector<sf::Vertex> quads;
+            std::vector<sf::Vertex> seams;
+
+            sf::VertexBuffer quadBuffer { sf::Quads, sf::VertexBuffer::Static };
+            sf::VertexBuffer seamBuffer { sf::Lines, sf::VertexBuffer::Static };
+            bool buffered { false };
+        };
+
+        sf::Vector2f center_;
+        float radius_ { 0.f };
+
+        std::unordered_map<std::uint64_t, Chunk> chunks_;
+
+        sf::VertexArray mask_ { sf::Triangles };
+        sf::VertexArray glow_ { sf::Triangles };
+        sf::VertexArray border_ { sf::Triangles };
+        float borderZoom_ { -1.f };
+
+        Chunk & GetChunk(int cx, int cy);
+        void BuildChunk(Chunk & chunk, int cx, int cy) const;
+        void BuildBorder(float zoom);
+
+    public:
+        // drops everything cached
+        void SetArena(const sf::Vector2f & center, float radius);
+
+        // world view must be set on `target`
+        void Draw(sf::RenderTarget & target, const sf::View & view, float zoom);
+    };
+
+} // namespace Core::App::Render::Batch
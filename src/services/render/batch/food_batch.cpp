@@ -0,0 +1,114 @@
+#include "food_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core::App::Render::Batch {
+
+    namespace
+    {
+        constexpr float Half = FoodBatch::CellSize / 2.f;
+
+        // the baked disc stops short of the cell edge so filtering never reaches a neighbour
+        constexpr float DiscRadius = Half - 2.f;
+        constexpr float DiscQuadScale = Half / DiscRadius;
+
+        float SmoothStep(const float edge0, const float edge1, const float x)
+        {
+            const float t = std::clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
+            return t * t * (3.f - 2.f * t);
+        }
+    }
+
+    bool FoodBatch::Create()
+    {
+        constexpr unsigned cells = static_cast<unsigned>(Cell::Count);
+
+        // white everywhere, coverage in alpha: the vertex color tints it, and filtering
+        // towards transparent texels does not darken the edges
+        sf::Image image;
+        image.create(CellSize * cells, CellSize, sf::Color(255, 255, 255, 0));
+
+        for (unsigned y = 0; y < CellSize; ++y)
+        {
+            for (unsigned x = 0; x < CellSize; ++x)
+            {
+                const float dx = static_cast<float>(x) + 0.5f - Half;
+                const float dy = static_cast<float>(y) + 0.5f - Half;
+                const float d = std::sqrt(dx * dx + dy * dy);
+
+                const float disc = std::clamp(DiscRadius + 0.5f - d, 0.f, 1.f);
+
+                // same falloff glow.frag computed per fragment
+                const float glow = 1.f - SmoothStep(0.f, 0.5f, d / static_cast<float>(CellSize));
+
+                const auto Alpha = [](const float v) { return static_cast<sf::Uint8>(std::lround(v * 255.f)); };
+
+                image.setPixel(x + CellSize * static_cast<unsigned>(Cell::Disc), y, sf::Color(255, 255, 255, Alpha(disc)));
+                image.setPixel(x + CellSize * static_cast<unsigned>(Cell::Glow), y, sf::Color(255, 255, 255, Alpha(glow)));
+            }
+        }
+
+        if (!atlas_.loadFromImage(image))
+            return false;
+
+        atlas_.setSmooth(true);
+        return true;
+    }
+
+    void FoodBatch::AddQuad(sf::VertexArray & vertices, const Cell cell, const sf::Vector2f & center, const float halfSize, const sf::Color & color)
+    {
+        // texCoords in pixels, SFML normalizes them by the bound texture
+        const float u0 = static_cast<float>(CellSize * static_cast<unsigned>(cell));
+        const float u1 = u0 + static_cast<float>(CellSize);
+        const float v0 = 0.f;
+        const float v1 = static_cast<float>(CellSize);
+
+        const float x0 = center.x - halfSize;
+        const float y0 = center.y - halfSize;
+        const float x1 = center.x + halfSize;
+        const float y1 = center.y + halfSize;
+
+        vertices.append(sf::Vertex({ x0, y0 }, color, { u0, v0 }));
+        vertices.append(sf::Vertex({ x1, y0 }, color, { u1, v0 }));
+        vertices.append(sf::Vertex({ x1, y1 }, color, { u1, v1 }));
+        vertices.append(sf::Vertex({ x0, y1 }, color, { u0, v1 }));
+    }
+
+    void FoodBatch::AddDisc(const sf::Vector2f & center, const float radius, const sf::Color & color)
+    {
+        AddQuad(solid_, Cell::Disc, center, radius * DiscQuadScale, color);
+    }
+
+    void FoodBatch::AddGlow(const sf::Vector2f & center, const float radius, const sf::Color & color, const float phase)
+    {
+        sf::Color c = color;
+        c.a = static_cast<sf::Uint8>(std::clamp(phase, 0.f, 1.f) * 255.f);
+
+        AddQuad(glow_, Cell::Glow, center, radius, c);
+    }
+
+    void FoodBatch::Draw(sf::RenderTarget & target, sf::Shader & glowShader, const float time) const
+    {
+        sf::RenderStates states;
+        states.texture = &atlas_;
+
+        if (solid_.getVertexCount() != 0)
+        {
+            states.blendMode = sf::BlendAlpha;
+            target.draw(solid_, states);
+        }
+
+        if (glow_.getVertexCount() != 0)
+        {
+            glowShader.setUniform("texture", sf::Shader::CurrentTexture);
+            glowShader.setUniform("time", time);
+            glowShader.setUniform("phaseSpan", PhaseSpan);
+
+            states.shader = &glowShader;
+            states.blendMode = sf::BlendAdd;
+            target.draw(glow_, states);
+        }
+    }
+
+} // namespace Core::App::Render::Batch
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <cstddef>
+
+namespace Core::App::Render::Batch {
+
+    // All food of a frame in two vertex arrays of textured quads over a small atlas baked
+    // at startup: solid discs (shadow, outline, ball, highlight) in one alpha-blended draw,
+    // glows in one additive draw through food_glow.frag. Two draw calls for any number of
+    // foods, no per-food tessellation or uniforms.
+    //
+    // Glow quads carry the food color in rgb and its pulse offset in alpha (the glow is not
+    // faded by alpha, the shader turns it back into a time offset of up to PhaseSpan).
+    class FoodBatch
+    {
+    public:
+        static constexpr unsigned CellSize = 64;
+        static constexpr float PhaseSpan = 8.f; // seconds
+
+    private:
+        enum class Cell : unsigned
+        {
+            Disc,
+            Glow,
+
+            Count
+        };
+
+        sf::Texture atlas_;
+        sf::VertexArray solid_ { sf::Quads };
+        sf::VertexArray glow_ { sf::Quads };
+
+        static void AddQuad(sf::VertexArray & vertices, Cell cell, const sf::Vector2f & center, float halfSize, const sf::Color & color);
+
+    public:
+        // bakes the atlas; false if the texture can not be created
+        bool Create();
+
+        void Clear()
+        {
+            solid_.clear();
+            glow_.clear();
+        }
+
+        [[nodiscard]] std::size_t QuadCount() const
+        {
+            return (solid_.getVertexCount() + glow_.getVertexCount()) / 4;
+        }
+
+        // anti-aliased filled circle, drawn in the order added
+        void AddDisc(const sf::Vector2f & center, float radius, const sf::Color & color);
+
+        // radial glow of `radius`; `phase` in [0, 1) desyncs the pulse between foods
+        void AddGlow(const sf::Vector2f & center, float radius, const sf::Color & color, float phase);
+
+        // discs, then all glows on top
+        void Draw(sf::RenderTarget & target, sf::Shader & glowShader, float time) const;
+    };
+
+} // namespace Core::App::Render::Batch
@@ -0,0 +1,59 @@
+#include "snake_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core::App::Render::Batch {
+
+    void SnakeBatch::AddQuad(const sf::Vector2f & center, const float halfSize, const sf::Color & color, const float kind, const float phase)
+    {
+        const float u0 = kind * 2.f + 0.25f;
+        const float v0 = phase * 2.f + 0.25f;
+        const float u1 = u0 + 0.5f;
+        const float v1 = v0 + 0.5f;
+
+        const float x0 = center.x - halfSize;
+        const float y0 = center.y - halfSize;
+        const float x1 = center.x + halfSize;
+        const float y1 = center.y + halfSize;
+
+        vertices_.append(sf::Vertex({ x0, y0 }, color, { u0, v0 }));
+        vertices_.append(sf::Vertex({ x1, y0 }, color, { u1, v0 }));
+        vertices_.append(sf::Vertex({ x1, y1 }, color, { u1, v1 }));
+        vertices_.append(sf::Vertex({ x0, y1 }, color, { u0, v1 }));
+    }
+
+    void SnakeBatch::AddDisc(const sf::Vector2f & center, const float radius, const sf::Color & color)
+    {
+        AddQuad(center, radius, color, 0.f, 0.f);
+    }
+
+    void SnakeBatch::AddBody(const sf::Vector2f & center, const float radius, const float outline, const sf::Color & color, const std::uint32_t phase)
+    {
+        const float total = radius + outline;
+        if (total <= 0.f)
+            return;
+
+        const auto step = std::clamp<std::uint32_t>(
+            static_cast<std::uint32_t>(std::lround(outline / total * OutlineSteps)), 0u, MaxOutlineStep);
+
+        // phase only drives a sine, keep it small enough for exact floats
+        AddQuad(center, total, color, 1.f + static_cast<float>(step), static_cast<float>(phase % 4096u));
+    }
+
+    void SnakeBatch::Draw(sf::RenderTarget & target, sf::Shader & shader, const sf::Texture & white, const float time) const
+    {
+        if (vertices_.getVertexCount() == 0)
+            return;
+
+        shader.setUniform("time", time);
+
+        sf::RenderStates states;
+        states.shader = &shader;
+        states.texture = &white;
+        states.blendMode = sf::BlendAlpha;
+
+        target.draw(vertices_, states);
+    }
+
+} // namespace Core::App::Render::Batch
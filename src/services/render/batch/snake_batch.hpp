@@ -0,0 +1,52 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Core::App::Render::Batch {
+
+    // Snake circles as textured quads in one vertex array, shaded by snake_batch.frag
+    // (SDF circle, outline and shimmer per fragment), so a layer of any number of circles
+    // is a single draw call. Quads are drawn in the order they were added.
+    //
+    // SFML vertices only carry position / color / texCoords, so the per-quad attributes
+    // ride in the integer part of the texCoords: 2 * (kind, phase) + 0.25 + 0.5 * corner.
+    // The fraction keeps clear of the integer boundaries, so interpolation never changes
+    // the decoded attribute.
+    class SnakeBatch
+    {
+    public:
+        // outline thickness resolution: 1/128 of the quad radius, up to ~half of it
+        static constexpr std::uint32_t OutlineSteps = 128;
+        static constexpr std::uint32_t MaxOutlineStep = 62;
+
+    private:
+        sf::VertexArray vertices_ { sf::Quads };
+
+        void AddQuad(const sf::Vector2f & center, float halfSize, const sf::Color & color, float kind, float phase);
+
+    public:
+        void Clear()
+        {
+            vertices_.clear();
+        }
+
+        [[nodiscard]] std::size_t QuadCount() const
+        {
+            return vertices_.getVertexCount() / 4;
+        }
+
+        // anti-aliased filled circle
+        void AddDisc(const sf::Vector2f & center, float radius, const sf::Color & color);
+
+        // body circle: `color` fill with an outside dark outline and the shimmer; `phase`
+        // (segment index) offsets the shimmer time
+        void AddBody(const sf::Vector2f & center, float radius, float outline, const sf::Color & color, std::uint32_t phase);
+
+        // one draw call; `white` is any texture with normalized coords (1x1 white)
+        void Draw(sf::RenderTarget & target, sf::Shader & shader, const sf::Texture & white, float time) const;
+    };
+
+} // namespace Core::App::Render::Batch
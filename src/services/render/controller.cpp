@@ -2,6 +2,8 @@
 
 #include "pages/[pages_loader].hpp"
 
+#include "components/profiler/profiler.hpp"
+
 namespace Core::App::Render
 {
     void Controller::Initialise()
@@ -62,6 +64,9 @@ namespace Core::App::Render
             }
 
             window_.display();
+
+            // display() waits for vsync: the frame ends here
+            Components::Profiler::Profiler().EndFrame();
         }
 
 
@@ -1,7 +1,10 @@
 #include "playing.hpp"
 #include "legacy_game_math.hpp"
 
+#include "components/profiler/profiler.hpp"
+
 #include <cmath>
+#include <cstdio>
 #include <filesystem>
 #include <algorithm>
 
@@ -39,6 +42,9 @@ static sf::Color AddAlpha(sf::Color c, int add)
 
 namespace Core::App::Render::Pages {
 
+    using Components::Profiler::Profiler;
+    using Components::Profiler::Phase;
+
     [[maybe_unused]] [[gnu::used]] Utils::Service::Loader::Add<Playing> PlayingPage(PagesLoader());
 
     void Playing::Initialise()
@@ -49,7 +55,7 @@ namespace Core::App::Render::Pages {
         // Debug panel (bottom-left)
         // ==========================
         {
-            const sf::Vector2f panelSize { 320.f, 330.f };
+            const sf::Vector2f panelSize { 320.f, 500.f };
             const sf::Vector2f panelCenter {
                 20.f + panelSize.x * 0.5f,
                 Height - 20.f - panelSize.y * 0.5f
@@ -132,13 +138,13 @@ namespace Core::App::Render::Pages {
         // ==========================
         // Shaders / textures
         // ==========================
-        std::filesystem::path glowShaderPath = "assets/resources/glow.frag";
-        std::filesystem::path snakeShaderPath = "assets/resources/snake.frag";
+        std::filesystem::path glowShaderPath = "assets/resources/food_glow.frag";
+        std::filesystem::path snakeShaderPath = "assets/resources/snake_batch.frag";
 
-        if (!glowShader.loadFromFile(glowShaderPath.string(), sf::Shader::Fragment))
+        if (!foodGlowShader_.loadFromFile(glowShaderPath.string(), sf::Shader::Fragment))
             throw std::runtime_error("Failed to load glow shader from " + glowShaderPath.string());
 
-        if (!snakeShader.loadFromFile(snakeShaderPath.string(), sf::Shader::Fragment))
+        if (!snakeBatchShader_.loadFromFile(snakeShaderPath.string(), sf::Shader::Fragment))
             throw std::runtime_error("Failed to load snake shader from " + snakeShaderPath.string());
 
         std::filesystem::path blurShaderPath = "assets/resources/liquid_blur.frag";
@@ -151,6 +157,11 @@ namespace Core::App::Render::Pages {
         sf::Uint8 pixel[] = {255, 255, 255, 255};
         whiteTexture.update(pixel);
 
+        if (!foodBatch_.Create())
+            throw std::runtime_error("Failed to create food atlas");
+
+        arena_.SetArena(Utils::Legacy::Game::AreaCenter, Utils::Legacy::Game::AreaRadius);
+
         RefreshLeaderboardUI();
     }
 
@@ -236,6 +247,7 @@ namespace Core::App::Render::Pages {
             return;
 
         frame_ = gameClient->GetServerFrame();
+        frameAlpha_ = gameClient->GetTickAlpha();
 
         RequestLeaderboard();
 
@@ -250,18 +262,52 @@ namespace Core::App::Render::Pages {
         // World render (camera view)
         // ==========================
         window.setView(view_);
-        DrawGrid(window);
 
-        for (const auto& food: gameClient->GetNearestFoods())
-            DrawFood(window, food);
+        {
+            const auto timer = Profiler().Measure(Phase::Grid);
+            DrawGrid(window);
+        }
+
+        // only what intersects the view (+ glow / body margin) is visited
+        const sf::Vector2f viewCenter = view_.getCenter();
+        const sf::Vector2f viewSize = view_.getSize();
+        const float viewRadius = 0.5f * std::sqrt(viewSize.x * viewSize.x + viewSize.y * viewSize.y);
 
-        DrawSnake(window, playerSnake);
-        for (const auto& snake: gameClient->GetNearestVictims())
-            DrawSnake(window, snake);
+        {
+            const auto timer = Profiler().Measure(Phase::Food);
+
+            gameClient->ForEachFoodInRadius(viewCenter, viewRadius + FoodRadius * 8.f, [&](const Game::Food& food)
+            {
+                QueueFood(food);
+            });
+
+            DrawFoods(window);
+        }
+
+        {
+            const auto timer = Profiler().Measure(Phase::Snakes);
+
+            pixelsPerUnit_ = static_cast<float>(window.getSize().x) / viewSize.x;
+            cullRect_ = sf::FloatRect(viewCenter - viewSize * 0.5f, viewSize);
+
+            // every visible snake goes into the shared batches, then one blur + one composite
+            if (const auto playerBody = gameClient->GetSnakeBody(playerSnake->EntityID()))
+                QueueSnake(*playerSnake, *playerBody);
+
+            gameClient->ForEachSnakeInRect(cullRect_, [&](const Game::Snake& snake, const Game::SegmentRing& body)
+            {
+                if (&snake != playerSnake.get())
+                    QueueSnake(snake, body);
+            });
+
+            DrawSnakes(window);
+        }
 
         // ==========================
         // UI render (screen space)
         // ==========================
+        const auto uiTimer = Profiler().Measure(Phase::UI);
+
         window.setView(window.getDefaultView());
 
         const auto cam = GetCameraCenter();
@@ -297,6 +343,15 @@ namespace Core::App::Render::Pages {
         text += "PendingFull: " + std::string(Bool(debug.pendingFullRequest)) + "\n";
         text += "AllSegments: " + std::string(Bool(debug.pendingFullRequestAllSegments)) + "\n";
         text += "AwaitRebuild:" + std::string(Bool(debug.awaitingPlayerRebuild)) + "\n";
+        text += "RTT:         " + std::to_string(static_cast<int>(debug.snapshotRttMs)) + " ms\n";
+        text += "Loss:        " + std::to_string(static_cast<int>(debug.lossPercent)) + " %\n";
+        text += "Repair:      " + std::to_string(debug.snapshotsInFlight) + "/" + std::to_string(debug.snapshotWindow)
+              + " (queued " + std::to_string(debug.snapshotsPending) + ")\n";
+        text += "Interp:      " + std::to_string(static_cast<int>(debug.interpolationDelayMs)) + " ms\n";
+        text += "Updates:     lost " + std::to_string(debug.updatesLost) + " reord " + std::to_string(debug.updatesReordered)
+              + " late " + std::to_string(debug.updatesLate) + "\n";
+        text += "Predict:     " + std::to_string(static_cast<int>(debug.predictionError)) + " px (unacked " + std::to_string(debug.inputsUnacked) + ")\n";
+        text += "QueueDrops:  " + std::to_string(debug.netInboundDrops) + " in / " + std::to_string(debug.netOutboundDrops) + " out\n";
 
         text += "\n=== Packets ===\n";
         text += "Full:    " + FormatBytes(debug.lastFullPacketBytes) + " (payload " + FormatBytes(debug.lastFullPayloadBytes) + ")\n";
@@ -307,6 +362,20 @@ namespace Core::App::Render::Pages {
         text += "Snakes:  " + std::to_string(debug.snakesCount) + "\n";
         text += "PlayerID:" + std::to_string(debug.playerEntityID) + "\n";
 
+        text += "\n=== Frame p50 / p99 ms ===\n";
+        for (std::size_t i = 0; i < Components::Profiler::PhaseCount; ++i)
+        {
+            const auto phase = static_cast<Phase>(i);
+            const auto stats = Profiler().GetStats(phase);
+
+            char line[64];
+            std::snprintf(line, sizeof(line), "%-11s %6.2f / %6.2f\n", Components::Profiler::PhaseName(phase), stats.p50Ms, stats.p99Ms);
+            text += line;
+        }
+
+        if (Profiler().IsTracing())
+            text += "Tracing... (F9 to save)\n";
+
         ui.debugText->SetText(text);
 
         ui.debugPanel->Update(window);
@@ -333,164 +402,38 @@ namespace Core::App::Render::Pages {
             gameClient->ForceFullUpdateRequest();
         }
 
-        if (event.type == sf::Event::KeyPressed && event.key.scancode == sf::Keyboard::Scancode::Escape)
+        // F9: start / stop a Chrome trace of the frame phases
+        if (event.type == sf::Event::KeyPressed && event.key.scancode == sf::Keyboard::Scancode::F9)
         {
-            gameController_->ExitToMenu();
-        }
-    }
-
-    void Playing::DrawGrid(sf::RenderWindow& window)
-    {
-        const sf::Vector2f fieldCenter = Utils::Legacy::Game::AreaCenter;
-        const float fieldRadius = Utils::Legacy::Game::AreaRadius;
-
-        // ==========================
-        // Checkerboard floor (dark)
-        // ==========================
-        const float tile = 220.f;                // размер клетки шахматки (в world units)
-        const float fadeEdge = tile * 1.25f;     // допуск на край круга (чтобы не было дыр)
-
-        // видимая область в мире (по текущему view_)
-        const sf::Vector2f viewCenter = view_.getCenter();
-        const sf::Vector2f viewSize = view_.getSize();
-        const float minX = viewCenter.x - viewSize.x * 0.5f;
-        const float maxX = viewCenter.x + viewSize.x * 0.5f;
-        const float minY = viewCenter.y - viewSize.y * 0.5f;
-        const float maxY = viewCenter.y + viewSize.y * 0.5f;
-
-        // клип по bounding box круга, чтобы лишнего не генерить
-        const float clipMinX = std::max(minX, fieldCenter.x - fieldRadius - tile);
-        const float clipMaxX = std::min(maxX, fieldCenter.x + fieldRadius + tile);
-        const float clipMinY = std::max(minY, fieldCenter.y - fieldRadius - tile);
-        const float clipMaxY = std::min(maxY, fieldCenter.y + fieldRadius + tile);
-
-        const float startX = std::floor(clipMinX / tile) * tile;
-        const float endX   = std::ceil (clipMaxX / tile) * tile;
-        const float startY = std::floor(clipMinY / tile) * tile;
-        const float endY   = std::ceil (clipMaxY / tile) * tile;
-
-        const sf::Color cA(12, 14, 20, 255);
-        const sf::Color cB(16, 18, 26, 255);
-
-        sf::VertexArray quads(sf::Quads);
-        quads.clear();
-
-        // мягкие “швы” (очень лёгкие линии)
-        sf::VertexArray seams(sf::Lines);
-        seams.clear();
-        const sf::Color seamCol(255, 255, 255, 8);
-
-        for (float y = startY; y < endY; y += tile)
-        {
-            for (float x = startX; x < endX; x += tile)
+            if (!Profiler().IsTracing())
             {
-                const sf::Vector2f center { x + tile * 0.5f, y + tile * 0.5f };
-                const sf::Vector2f d = center - fieldCenter;
-
-                // грубый клип по кругу (берём тайлы около края тоже)
-                if (Len(d) > fieldRadius + fadeEdge)
-                    continue;
-
-                const int ix = static_cast<int>(std::floor(x / tile));
-                const int iy = static_cast<int>(std::floor(y / tile));
-                const bool odd = ((ix + iy) & 1) != 0;
-
-                sf::Color col = odd ? cA : cB;
-
-                // лёгкая виньетка по расстоянию от центра (даёт объём)
-                const float dist01 = std::clamp(Len(center - fieldCenter) / fieldRadius, 0.f, 1.f);
-                // темнее ближе к краю
-                const float dark = 1.f - dist01 * 0.20f;
-                col.r = static_cast<sf::Uint8>(static_cast<float>(col.r) * dark);
-                col.g = static_cast<sf::Uint8>(static_cast<float>(col.g) * dark);
-                col.b = static_cast<sf::Uint8>(static_cast<float>(col.b) * dark);
-
-                // quad
-                quads.append(sf::Vertex({ x,         y        }, col));
-                quads.append(sf::Vertex({ x + tile,  y        }, col));
-                quads.append(sf::Vertex({ x + tile,  y + tile }, col));
-                quads.append(sf::Vertex({ x,         y + tile }, col));
-
-                // seams (очень слабые линии, чисто чтобы “сетка” читалась)
-                // вертикальная справа
-                seams.append(sf::Vertex({ x + tile, y }, seamCol));
-                seams.append(sf::Vertex({ x + tile, y + tile }, seamCol));
-                // горизонтальная снизу
-                seams.append(sf::Vertex({ x, y + tile }, seamCol));
-                seams.append(sf::Vertex({ x + tile, y + tile }, seamCol));
+                Profiler().StartTrace();
+            }
+            else if (Profiler().StopTrace("frame_trace.json"))
+            {
+                Log()->Debug("Frame trace written to frame_trace.json");
+            }
+            else
+            {
+                Log()->Error("Failed to write frame_trace.json");
             }
         }
 
-        window.draw(quads);
-        window.draw(seams);
-
-        // ==========================
-        // Mask ring (covers chessboard corners outside the circle)
-        // Inner edge = fieldRadius, outer edge = fieldRadius + maskThickness
-        // ==========================
-        {
-            // сколько “наружу” перекрываем (в world units)
-            // должно быть >= максимального вылета углов тайла за окружность
-            const float maskThickness = tile * 1.30f;
-
-            // радиус задаём так, чтобы внутренняя граница была ровно fieldRadius:
-            // inner = R - T/2 => R = fieldRadius + T/2
-            const float r = fieldRadius + maskThickness * 0.5f;
-
-            sf::CircleShape mask(r, 220);
-            mask.setOrigin(r, r);
-            mask.setPosition(fieldCenter);
-            mask.setFillColor(sf::Color::Transparent);
-
-            // цвет “вне поля” (сделай как у твоего общего фона, но темнее шахматки)
-            mask.setOutlineColor(sf::Color(6, 7, 10, 255));
-            mask.setOutlineThickness(maskThickness);
-
-            window.draw(mask);
-        }
-
-        // ==========================
-        // Border: energy ring + main ring
-        // ==========================
-        const float baseThickness = 16.f * zoom_; // держим “пиксельный” размер примерно постоянным
-
-        // glow layers (additive)
-        for (int i = 0; i < 5; ++i)
+        if (event.type == sf::Event::KeyPressed && event.key.scancode == sf::Keyboard::Scancode::Escape)
         {
-            const float t = static_cast<float>(i);
-            const float thick = baseThickness + (22.f * zoom_) + t * (18.f * zoom_);
-            sf::CircleShape glow(fieldRadius, 160);
-            glow.setOrigin(fieldRadius, fieldRadius);
-            glow.setPosition(fieldCenter);
-            glow.setFillColor(sf::Color::Transparent);
-            glow.setOutlineThickness(thick);
-
-            // чуть “малиновый” glow
-            sf::Color gc(255, 60, 80, 0);
-            gc.a = static_cast<sf::Uint8>(70 - i * 12);
-            glow.setOutlineColor(gc);
-
-            sf::RenderStates st;
-            st.blendMode = sf::BlendAdd;
-            window.draw(glow, st);
+            gameController_->ExitToMenu();
         }
+    }
 
-        // main ring
-        sf::CircleShape circle(fieldRadius, 200);
-        circle.setOrigin(fieldRadius, fieldRadius);
-        circle.setPosition(fieldCenter);
-        circle.setFillColor(sf::Color::Transparent);
-        circle.setOutlineColor(sf::Color(255, 80, 90, 230));
-        circle.setOutlineThickness(baseThickness);
-
-        window.draw(circle);
+    void Playing::DrawGrid(sf::RenderWindow& window)
+    {
+        arena_.Draw(window, view_, zoom_);
     }
 
 
-    void Playing::DrawSnake(sf::RenderWindow& window,
-                        const Utils::Legacy::Game::Interface::Entity::Snake::Shared& snake)
+    void Playing::QueueSnake(const Utils::Legacy::Game::Interface::Entity::Snake& snake,
+                             const Game::SegmentRing& segments)
     {
-        const auto& segments = snake->Segments();
         const std::size_t segCount = segments.size();
         if (segCount == 0)
             return;
@@ -523,51 +466,55 @@ namespace Core::App::Render::Pages {
         };
 
         // === sizes + smooth spawn/kill ===
-        float headRadius = snake->GetRadius(true);
-        float bodyRadius = snake->GetRadius(false);
+        float headRadius = snake.GetRadius(true);
+        float bodyRadius = snake.GetRadius(false);
 
         float factor = 1.f;
-        if (snake->IsKilled())
+        if (snake.IsKilled())
         {
-            const auto frames = frame_ - snake->FrameKilled();
+            const float frames = static_cast<float>(frame_ - snake.FrameKilled()) + frameAlpha_;
             if (frames > SmoothDuration)
                 return;
             factor = (SmoothDuration - frames) / SmoothDuration;
         }
-        else if (frame_ - snake->FrameCreated() < SmoothDuration)
+        else if (frame_ - snake.FrameCreated() < SmoothDuration)
         {
-            const auto frames = frame_ - snake->FrameCreated();
+            const float frames = static_cast<float>(frame_ - snake.FrameCreated()) + frameAlpha_;
             factor = frames / SmoothDuration;
         }
 
         headRadius *= factor;
         bodyRadius *= factor;
 
-        // === adaptive segment rendering (less when bigger) ===
-        constexpr int kMaxRender = 220;
-        constexpr int kMinRender = 90;
-
-        int target = static_cast<int>(segCount);
-        if (segCount > static_cast<std::size_t>(kMaxRender))
-        {
-            const float k = std::sqrt(static_cast<float>(kMaxRender) / static_cast<float>(segCount));
-            target = static_cast<int>(std::round(static_cast<float>(kMaxRender) * k));
-        }
-        target = std::clamp(target, kMinRender, kMaxRender);
-
-        const std::size_t stride = (segCount <= static_cast<std::size_t>(target))
-            ? 1
-            : static_cast<std::size_t>((segCount + static_cast<std::size_t>(target) - 1) / static_cast<std::size_t>(target));
-
-        // меньше "дыр" при stride
-        const float thicknessBoost = (stride <= 1) ? 1.f : std::min(1.f + 0.10f * static_cast<float>(stride - 1), 2.0f);
+        // === LOD from the on-screen body radius ===
+        const SnakeLod lod = PickSnakeLod(snake.EntityID(), bodyRadius * pixelsPerUnit_);
+
+        // stride: the largest step that still leaves no holes (drawn circles at most about
+        // half a radius apart); below Full the gap may also grow to a few pixels on screen,
+        // so a far-away snake a couple of pixels wide does not get a quad every 0.7 r
+        constexpr float kMaxGapPx = 3.f;
+        const float segmentStep = (segCount > 2) ? Len(segments[1] - segments[2]) : bodyRadius;
+        const float maxGap = (lod == SnakeLod::Full)
+            ? bodyRadius * 0.5f
+            : std::max(bodyRadius * 0.7f, kMaxGapPx / pixelsPerUnit_);
+        const std::size_t stride = std::clamp<std::size_t>(
+            static_cast<std::size_t>(maxGap / std::max(segmentStep, 0.001f)), 1, 64);
+
+        // === view culling before any geometry: whatever can still touch the screen ===
+        // shadow / soft circles reach ~1.2 r, the blur spreads the soft pass a few pixels more
+        constexpr float kBlurMarginPx = 24.f;
+        const float cullMargin = std::max(headRadius, bodyRadius) * 1.3f + kBlurMarginPx / pixelsPerUnit_;
+        const float cullMinX = cullRect_.left - cullMargin;
+        const float cullMinY = cullRect_.top - cullMargin;
+        const float cullMaxX = cullRect_.left + cullRect_.width + cullMargin;
+        const float cullMaxY = cullRect_.top + cullRect_.height + cullMargin;
 
         // === HEAD is FRONT() (begin), direction from destination ===
         const sf::Vector2f headPos = *segments.begin();
 
         sf::Vector2f dir { 1.f, 0.f };
         {
-            const sf::Vector2f dest = snake->GetDestination();
+            const sf::Vector2f dest = snake.GetDestination();
             dir = NormalizeLocal(dest - headPos);
         }
         const sf::Vector2f n { -dir.y, dir.x };
@@ -579,8 +526,8 @@ namespace Core::App::Render::Pages {
 
         const float time0 = clock.getElapsedTime().asSeconds();
 
-        // --- helper: draw geometry (soft pass / sharp pass) ---
-        auto DrawGeometry = [&](sf::RenderTarget& targetRT, bool softPass)
+        // --- helper: geometry into a batch (soft pass / sharp pass), one quad per circle ---
+        auto BuildGeometry = [&](Batch::SnakeBatch& batch, bool softPass)
         {
             std::size_t idx = 0;
 
@@ -594,7 +541,10 @@ namespace Core::App::Render::Pages {
 
                 const sf::Vector2f pos = *it;
 
-                float r = (isHead ? headRadius : bodyRadius) * thicknessBoost;
+                if (pos.x < cullMinX || pos.x > cullMaxX || pos.y < cullMinY || pos.y > cullMaxY)
+                    continue;
+
+                const float r = isHead ? headRadius : bodyRadius;
 
                 // subtle stripe factor (dark range)
                 const float stripe = 0.78f + 0.07f * std::sin(time0 * 1.2f + static_cast<float>(idx) * 0.33f);
@@ -606,79 +556,45 @@ namespace Core::App::Render::Pages {
                 // soft pass: only filled circles (for blur)
                 if (softPass)
                 {
-                    sf::CircleShape c(r * 1.04f, 32);
-                    c.setOrigin(r * 1.04f, r * 1.04f);
-                    c.setPosition(pos);
                     // чуть светлее, чтобы блюр читался, но НЕ пересвечивал
                     sf::Color soft = col;
                     soft = ScaleRGB(soft, 1.10f);
-                    soft.a = static_cast<sf::Uint8>(std::min(200.f, 140.f * factor + 60.f));
-                    c.setFillColor(soft);
-                    targetRT.draw(c);
+                    // the underlay is composited once for all snakes: spawn / kill fade goes here
+                    soft.a = static_cast<sf::Uint8>(std::min(200.f, 140.f * factor + 60.f) * factor);
+                    batch.AddDisc(pos, r * 1.04f, soft);
                     continue;
                 }
 
-                // sharp pass: аккуратное тело + слабая тень
-                // 1) weaker shadow
+                // a few pixels on screen: flat disc, nothing else would be visible
+                if (lod == SnakeLod::Low)
                 {
-                    const float sr = r * 1.05f;
-                    sf::CircleShape sh(sr, 28);
-                    sh.setOrigin(sr, sr);
-                    sh.setPosition(pos + sf::Vector2f(r * 0.08f, r * 0.12f));
-                    sh.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(55.f, 25.f + 30.f * factor))));
-                    targetRT.draw(sh);
+                    batch.AddDisc(pos, r, col);
+                    continue;
                 }
 
-                // 2) base body (darker) + very thin outline
-                sf::CircleShape circle(r, 36);
-                circle.setOrigin(r, r);
-                circle.setPosition(pos);
-                circle.setFillColor(col);
+                // sharp pass: аккуратное тело + слабая тень
+                // 1) weaker shadow
+                batch.AddDisc(pos + sf::Vector2f(r * 0.08f, r * 0.12f), r * 1.05f,
+                              sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(55.f, 25.f + 30.f * factor))));
 
+                // 2) base body (darker) + very thin outline + shimmer (toned down), all in the shader
                 const float outline = std::max(0.8f * zoom_, 0.03f * r);
-                circle.setOutlineThickness(outline);
-                circle.setOutlineColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(110.f, 60.f + 50.f * factor))));
-                targetRT.draw(circle);
+                batch.AddBody(pos, r, outline, col, static_cast<std::uint32_t>(idx));
+
+                if (lod != SnakeLod::Full)
+                    continue;
 
                 // 3) tiny highlight (very subtle, no overglow)
                 {
-                    sf::CircleShape hi(r * 0.42f, 26);
-                    hi.setOrigin(r * 0.42f, r * 0.42f);
-
                     sf::Vector2f hOff = isHead
                         ? (-dir * (r * 0.18f) - n * (r * 0.14f))
                         : sf::Vector2f(-r * 0.14f, -r * 0.14f);
 
-                    hi.setPosition(pos + hOff);
-
-                    sf::Color hc(255, 255, 255, static_cast<sf::Uint8>(std::clamp(10.f + 10.f * factor, 0.f, 22.f)));
-                    hi.setFillColor(hc);
-
-                    sf::RenderStates st;
-                    st.blendMode = sf::BlendAlpha;
-                    targetRT.draw(hi, st);
+                    batch.AddDisc(pos + hOff, r * 0.42f,
+                                  sf::Color(255, 255, 255, static_cast<sf::Uint8>(std::clamp(10.f + 10.f * factor, 0.f, 22.f))));
                 }
 
-                // 4) shimmer shader (toned down)
-                circle.setTexture(&whiteTexture);
-
-                const float time = time0 + static_cast<float>(idx) * 0.045f;
-                snakeShader.setUniform("time", time);
-
-                // baseColor darker + lower alpha so it doesn't blow out
-                snakeShader.setUniform("baseColor", sf::Glsl::Vec4(
-                    (col.r / 255.f) * 0.85f,
-                    (col.g / 255.f) * 0.85f,
-                    (col.b / 255.f) * 0.85f,
-                    (col.a / 255.f) * 0.65f
-                ));
-
-                sf::RenderStates states;
-                states.shader = &snakeShader;
-                states.blendMode = sf::BlendAlpha;
-                targetRT.draw(circle, states);
-
-                // 5) eyes (high contrast, outline)
+                // 4) eyes (high contrast, outline)
                 if (isHead)
                 {
                     const float eyeR = r * 0.18f;
@@ -688,42 +604,87 @@ namespace Core::App::Render::Pages {
                     const sf::Vector2f e2 = eyeBase - n * (r * 0.28f);
 
                     // outline ring
-                    {
-                        sf::CircleShape ring(eyeR * 1.18f, 24);
-                        ring.setOrigin(eyeR * 1.18f, eyeR * 1.18f);
-                        ring.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(200.f, 160.f * factor + 40.f))));
-                        ring.setPosition(e1); targetRT.draw(ring);
-                        ring.setPosition(e2); targetRT.draw(ring);
-                    }
+                    const sf::Color ring(0, 0, 0, static_cast<sf::Uint8>(std::min(200.f, 160.f * factor + 40.f)));
+                    batch.AddDisc(e1, eyeR * 1.18f, ring);
+                    batch.AddDisc(e2, eyeR * 1.18f, ring);
 
                     // sclera
-                    sf::CircleShape eye(eyeR, 22);
-                    eye.setOrigin(eyeR, eyeR);
-                    eye.setFillColor(sf::Color(235, 235, 235, static_cast<sf::Uint8>(std::min(255.f, 220.f * factor + 35.f))));
-                    eye.setPosition(e1); targetRT.draw(eye);
-                    eye.setPosition(e2); targetRT.draw(eye);
+                    const sf::Color sclera(235, 235, 235, static_cast<sf::Uint8>(std::min(255.f, 220.f * factor + 35.f)));
+                    batch.AddDisc(e1, eyeR, sclera);
+                    batch.AddDisc(e2, eyeR, sclera);
 
                     // pupil
                     const float pupR = eyeR * 0.42f;
-                    sf::CircleShape pup(pupR, 18);
-                    pup.setOrigin(pupR, pupR);
-                    pup.setFillColor(sf::Color(10, 10, 10, static_cast<sf::Uint8>(std::min(255.f, 230.f * factor + 25.f))));
-
+                    const sf::Color pupil(10, 10, 10, static_cast<sf::Uint8>(std::min(255.f, 230.f * factor + 25.f)));
                     const sf::Vector2f pupOff = dir * (eyeR * 0.75f);
-                    pup.setPosition(e1 + pupOff); targetRT.draw(pup);
-                    pup.setPosition(e2 + pupOff); targetRT.draw(pup);
+                    batch.AddDisc(e1 + pupOff, pupR, pupil);
+                    batch.AddDisc(e2 + pupOff, pupR, pupil);
 
                     // spec dot
                     const float dotR = pupR * 0.28f;
-                    sf::CircleShape dot(dotR, 12);
-                    dot.setOrigin(dotR, dotR);
-                    dot.setFillColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(std::min(180.f, 120.f * factor + 60.f))));
-                    dot.setPosition(e1 + pupOff + sf::Vector2f(-dotR * 0.6f, -dotR * 0.6f)); targetRT.draw(dot);
-                    dot.setPosition(e2 + pupOff + sf::Vector2f(-dotR * 0.6f, -dotR * 0.6f)); targetRT.draw(dot);
+                    const sf::Color spec(255, 255, 255, static_cast<sf::Uint8>(std::min(180.f, 120.f * factor + 60.f)));
+                    const sf::Vector2f dotOff = pupOff + sf::Vector2f(-dotR * 0.6f, -dotR * 0.6f);
+                    batch.AddDisc(e1 + dotOff, dotR, spec);
+                    batch.AddDisc(e2 + dotOff, dotR, spec);
                 }
             }
         };
 
+        // the blurred underlay of a snake a few pixels wide is not visible
+        if (lod != SnakeLod::Low)
+            BuildGeometry(softBatch_, /*softPass=*/true);
+
+        BuildGeometry(sharpBatch_, /*softPass=*/false);
+    }
+
+    Playing::SnakeLod Playing::PickSnakeLod(const uint32_t entityID, const float radiusPx)
+    {
+        constexpr float kFullPx = 8.f;      // eyes / highlight readable
+        constexpr float kMediumPx = 2.5f;   // outline / shimmer / blur readable
+        constexpr float kHysteresis = 0.2f; // a level changes only 20% past its threshold
+
+        auto Level = [&](const float scale)
+        {
+            if (radiusPx >= kFullPx * scale) return SnakeLod::Full;
+            if (radiusPx >= kMediumPx * scale) return SnakeLod::Medium;
+            return SnakeLod::Low;
+        };
+
+        auto [it, inserted] = snakeLod_.try_emplace(entityID);
+        auto& state = it->second;
+        state.seen = true;
+
+        if (inserted)
+        {
+            state.level = Level(1.f);
+            return state.level;
+        }
+
+        const SnakeLod up = Level(1.f + kHysteresis);
+        const SnakeLod down = Level(1.f - kHysteresis);
+
+        if (up > state.level)
+            state.level = up;
+        else if (down < state.level)
+            state.level = down;
+
+        return state.level;
+    }
+
+    void Playing::DrawSnakes(sf::RenderWindow& window)
+    {
+        // LOD state of snakes not queued this frame is dropped
+        std::erase_if(snakeLod_, [](const auto& entry) { return !entry.second.seen; });
+        for (auto& [id, state] : snakeLod_)
+            state.seen = false;
+
+        if (sharpBatch_.QuadCount() == 0)
+            return;
+
+        const float time = clock.getElapsedTime().asSeconds();
+
+        const auto blurStart = Components::Profiler::FrameProfiler::Clock::now();
+
         // === Ensure blur RTs (half-res for liquid look + performance) ===
         const sf::Vector2u win = window.getSize();
         const sf::Vector2u want {
@@ -747,7 +708,7 @@ namespace Core::App::Render::Pages {
         // === 1) render soft mass into snakeSoftRT_ (world view) ===
         snakeSoftRT_.setView(view_);
         snakeSoftRT_.clear(sf::Color(0, 0, 0, 0));
-        DrawGeometry(snakeSoftRT_, /*softPass=*/true);
+        softBatch_.Draw(snakeSoftRT_, snakeBatchShader_, whiteTexture, time);
         snakeSoftRT_.display();
 
         // sprite from softRT
@@ -804,95 +765,72 @@ namespace Core::App::Render::Pages {
             );
 
             // two layers: soft alpha + tiny additive (liquid glow, but dark)
-            blurSpr.setColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(std::clamp(70.f * factor, 0.f, 90.f))));
+            blurSpr.setColor(sf::Color(255, 255, 255, 70));
             window.draw(blurSpr, sf::RenderStates(sf::BlendAlpha));
 
-            blurSpr.setColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(std::clamp(22.f * factor, 0.f, 35.f))));
+            blurSpr.setColor(sf::Color(255, 255, 255, 22));
             window.draw(blurSpr, sf::RenderStates(sf::BlendAdd));
         }
 
+        Profiler().Add(Phase::Blur, blurStart, Components::Profiler::FrameProfiler::Clock::now());
+
         // sharp geometry on top
         window.setView(oldView);
-        DrawGeometry(window, /*softPass=*/false);
+        sharpBatch_.Draw(window, snakeBatchShader_, whiteTexture, time);
+
+        softBatch_.Clear();
+        sharpBatch_.Clear();
     }
 
-    void Playing::DrawFood(sf::RenderWindow& window,
-                       const Utils::Legacy::Game::Interface::Entity::Food::Shared& food)
+    void Playing::QueueFood(const Utils::Legacy::Game::Interface::Entity::Food& food)
     {
-        auto colorBase = food->GetColor();
+        auto colorBase = food.GetColor();
         sf::Color color = {colorBase.a, colorBase.r, colorBase.g, colorBase.b};
-        float radius = food->GetRadius();
+        float radius = food.GetRadius();
 
         float factor = 1.f;
-        if (food->IsKilled())
+        if (food.IsKilled())
         {
-            const auto frames = frame_ - food->FrameKilled();
+            const float frames = static_cast<float>(frame_ - food.FrameKilled()) + frameAlpha_;
             if (frames > SmoothDuration)
                 return;
             factor = (SmoothDuration - frames) / SmoothDuration;
         }
-        else if (frame_ - food->FrameCreated() < SmoothDuration)
+        else if (frame_ - food.FrameCreated() < SmoothDuration)
         {
-            const auto frames = frame_ - food->FrameCreated();
+            const float frames = static_cast<float>(frame_ - food.FrameCreated()) + frameAlpha_;
             factor = frames / SmoothDuration;
         }
 
         radius *= factor;
         color = MulAlpha(color, factor);
 
-        const sf::Vector2f pos = food->GetPosition();
+        const sf::Vector2f pos = food.GetPosition();
 
         // 1) Shadow
-        {
-            sf::CircleShape sh(radius * 1.20f, 30);
-            sh.setOrigin(radius * 1.20f, radius * 1.20f);
-            sh.setPosition(pos + sf::Vector2f(radius * 0.22f, radius * 0.32f));
-            sh.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(140.f, 40.f + 70.f * factor))));
-            window.draw(sh);
-        }
-
-        // 2) Base ball (слегка темнее по краю через outline)
-        sf::CircleShape mainBall(radius, 40);
-        mainBall.setOrigin(radius, radius);
-        mainBall.setPosition(pos);
-        mainBall.setFillColor(color);
+        foodBatch_.AddDisc(pos + sf::Vector2f(radius * 0.22f, radius * 0.32f), radius * 1.20f,
+                           sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(140.f, 40.f + 70.f * factor))));
 
+        // 2) Base ball (слегка темнее по краю: outline = диск побольше под ним)
         const float outline = std::max(1.2f * zoom_, radius * 0.08f);
-        mainBall.setOutlineThickness(outline);
-        mainBall.setOutlineColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(140, 80 + static_cast<int>(outline)))));
-
-        window.draw(mainBall);
+        foodBatch_.AddDisc(pos, radius + outline,
+                           sf::Color(0, 0, 0, static_cast<sf::Uint8>(std::min(140, 80 + static_cast<int>(outline)))));
+        foodBatch_.AddDisc(pos, radius, color);
 
         // 3) Highlight
-        {
-            sf::CircleShape hi(radius * 0.48f, 32);
-            hi.setOrigin(radius * 0.48f, radius * 0.48f);
-            hi.setPosition(pos + sf::Vector2f(-radius * 0.22f, -radius * 0.24f));
-            hi.setFillColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(18 + 18 * factor)));
-            window.draw(hi);
-        }
-
-        // 4) Glow ring (additive shader)
-        const float glowRadius = radius * 3.1f;
-        sf::CircleShape glowBall(glowRadius, 50);
-        glowBall.setOrigin(glowRadius, glowRadius);
-        glowBall.setPosition(pos);
-        glowBall.setFillColor(sf::Color::White);
-        glowBall.setTexture(&whiteTexture);
+        foodBatch_.AddDisc(pos + sf::Vector2f(-radius * 0.22f, -radius * 0.24f), radius * 0.48f,
+                           sf::Color(255, 255, 255, static_cast<sf::Uint8>(18 + 18 * factor)));
 
-        const float t = clock.getElapsedTime().asSeconds();
-        const float time = t + (pos.x * 0.0007f + pos.y * 0.0005f); // детерминированный сдвиг по позиции
-        const float pulseSpeed = 0.9f + 0.35f * std::sin(time * 0.8f);
-
-        glowShader.setUniform("time", time);
-        glowShader.setUniform("baseColor", sf::Glsl::Vec4(color.r / 255.f, color.g / 255.f, color.b / 255.f, 1.f));
-        glowShader.setUniform("pulseSpeed", pulseSpeed);
-
-        sf::RenderStates states;
-        states.shader = &glowShader;
-        states.blendMode = sf::BlendAdd;
+        // 4) Glow ring (additive, pulse in the shader)
+        const float offset = pos.x * 0.0007f + pos.y * 0.0005f; // детерминированный сдвиг по позиции
+        const float phase = offset / Batch::FoodBatch::PhaseSpan;
+        foodBatch_.AddGlow(pos, radius * 3.1f, color, phase - std::floor(phase));
+    }
 
-        window.draw(glowBall, states);
+    void Playing::DrawFoods(sf::RenderWindow& window)
+    {
+        foodBatch_.Draw(window, foodGlowShader_, clock.getElapsedTime().asSeconds());
+        foodBatch_.Clear();
     }
 
     sf::Vector2f Playing::GetCameraCenter()
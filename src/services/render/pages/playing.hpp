@@ -4,6 +4,9 @@
 
 #include "../components/text/component.hpp"
 #include "../components/block/component.hpp"
+#include "../batch/snake_batch.hpp"
+#include "../batch/food_batch.hpp"
+#include "../batch/arena_background.hpp"
 
 #include "network/websocket/interfaces/client.hpp"
 
@@ -35,8 +38,19 @@ namespace Core::App::Render::Pages {
 
         sf::Clock clock;
         sf::Font font;
-        sf::Shader glowShader, snakeShader;
+        sf::Shader foodGlowShader_;
+        sf::Shader snakeBatchShader_;
         sf::Texture whiteTexture;
+
+        // all snakes of the frame, in draw order; cleared by DrawSnakes()
+        Batch::SnakeBatch softBatch_;
+        Batch::SnakeBatch sharpBatch_;
+
+        // all food of the frame; cleared by DrawFoods()
+        Batch::FoodBatch foodBatch_;
+
+        Batch::ArenaBackground arena_;
+
         sf::RenderTexture snakeSoftRT_;
         sf::RenderTexture blurPingRT_;
         sf::RenderTexture blurPongRT_;
@@ -44,7 +58,26 @@ namespace Core::App::Render::Pages {
 
         sf::Vector2u blurRTSize_ { 0u, 0u };
 
+        // ===== Snake LOD =====
+        enum class SnakeLod : std::uint8_t
+        {
+            Low,    // flat discs, no blur
+            Medium, // + shadow, outline, shimmer, blur
+            Full    // + highlight, eyes
+        };
+
+        struct SnakeLodState
+        {
+            SnakeLod level { SnakeLod::Full };
+            bool seen { false };
+        };
+
+        std::unordered_map<uint32_t, SnakeLodState> snakeLod_;
+        float pixelsPerUnit_ = 1.f;
+        sf::FloatRect cullRect_;
+
         uint32_t frame_ = 0;
+        float frameAlpha_ = 0.f; // position between frame_ and frame_ + 1
 
         // ===== Leaderboard =====
         std::vector<std::pair<std::string, uint32_t>> leaderboardSorted_;
@@ -71,9 +104,16 @@ namespace Core::App::Render::Pages {
 
         void DrawGrid(sf::RenderWindow & window);
 
-        void DrawSnake(sf::RenderWindow & window, const Utils::Legacy::Game::Interface::Entity::Snake::Shared & snake);
+        // appends the snake to the frame's soft / sharp batches, DrawSnakes() draws them all
+        void QueueSnake(const Utils::Legacy::Game::Interface::Entity::Snake & snake, const Game::SegmentRing & segments);
 
-        void DrawFood(sf::RenderWindow & window, const Utils::Legacy::Game::Interface::Entity::Food::Shared & food);
+        // soft mass of all snakes blurred once, composited once, then the sharp geometry
+        void DrawSnakes(sf::RenderWindow & window);
+
+        // appends the food to the frame's batch, DrawFoods() draws them all
+        void QueueFood(const Utils::Legacy::Game::Interface::Entity::Food & food);
+
+        void DrawFoods(sf::RenderWindow & window);
 
         sf::Vector2f GetCameraCenter();
 
@@ -84,6 +124,9 @@ namespace Core::App::Render::Pages {
         sf::Vector2f GetMousePosition(sf::RenderWindow & window);
 
     private:
+        // level for the snake's on-screen body radius, with hysteresis per snake
+        SnakeLod PickSnakeLod(uint32_t entityID, float radiusPx);
+
         void RefreshLeaderboardUI();
         void RequestLeaderboard();
 
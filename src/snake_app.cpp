@@ -2,8 +2,6 @@
 #include "logging.hpp"
 #include "coroutine.hpp"
 
-#include <thread>
-
 [[noreturn]] int main()
 {
     const auto log = Utils::Logging::Logger::Create("CORE");
@@ -20,8 +18,9 @@
 
     log->Msg("Core services initialised");
 
+    // no sleep: the render service blocks on vsync, the game client runs its own
+    // fixed 64 Hz accumulator inside ProcessTick
     for (;;) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
         loader.ProcessTick();
         Utils::GetTaskManager().ClearFinishedTasks();
     }